@@ -1,11 +1,14 @@
 /*
  * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
 #include <stdbool.h>
+#include <string.h>
 #include "target.h"
 #include "flash_map/flash_map.h"
 #include "flash_map_backend/flash_map_backend.h"
@@ -18,6 +21,11 @@
 
 #define FLASH_PROGRAM_UNIT    TFM_HAL_FLASH_PROGRAM_UNIT
 
+/* Size of the buffer filled ahead of sequential reads, 0 disables it */
+#ifndef BL2_FLASH_READ_AHEAD_SIZE
+#define BL2_FLASH_READ_AHEAD_SIZE 0
+#endif
+
 /**
  * Return the greatest value not greater than `value` that is aligned to
  * `alignment`.
@@ -36,6 +44,21 @@ extern const int flash_map_entry_num;
 extern const ARM_DRIVER_FLASH  *flash_driver[];
 extern const int flash_driver_entry_num;
 
+#if BL2_FLASH_READ_AHEAD_SIZE > 0
+/*
+ * Data read ahead of a sequential reader, such as the image hash loop, so that
+ * the flash driver is called once per BL2_FLASH_READ_AHEAD_SIZE bytes instead
+ * of once per chunk. Addresses are relative to the flash device.
+ */
+static struct {
+    const ARM_DRIVER_FLASH *driver;
+    uint32_t next_addr; /* End of the last read, to detect sequential reads */
+    uint32_t addr;      /* Address of buf[0] */
+    uint32_t len;       /* Valid bytes in buf, 0 if empty */
+    uint8_t buf[BL2_FLASH_READ_AHEAD_SIZE] __attribute__((aligned(4)));
+} read_ahead;
+#endif /* BL2_FLASH_READ_AHEAD_SIZE > 0 */
+
 /* Valid entries for data item width */
 static const uint32_t data_width_byte[] = {
     sizeof(uint8_t),
@@ -106,12 +129,10 @@ void flash_area_close(const struct flash_area *area)
 }
 
 /*
- * Read/write/erase. Offset is relative from beginning of flash area.
- * `off` and `len` can be any alignment.
- * Return 0 on success, other value on failure.
+ * Read through the flash driver, or DMA if available.
  */
-int flash_area_read(const struct flash_area *area, uint32_t off, void *dst,
-                    uint32_t len)
+static int flash_read(const struct flash_area *area, uint32_t off, void *dst,
+                      uint32_t len)
 {
     uint32_t remaining_len, read_length;
     uint32_t aligned_off;
@@ -127,11 +148,6 @@ int flash_area_read(const struct flash_area *area, uint32_t off, void *dst,
 
     ARM_FLASH_CAPABILITIES DriverCapabilities;
 
-    BOOT_LOG_DBG("read area=%d, off=%#x, len=%#x", area->fa_id, off, len);
-
-    if (!is_range_valid(area, off, len)) {
-        return -1;
-    }
     remaining_len = len;
 
     /* CMSIS ARM_FLASH_ReadData API requires the `addr` data type size aligned.
@@ -218,11 +234,101 @@ int flash_area_read(const struct flash_area *area, uint32_t off, void *dst,
     }
 }
 
+#if BL2_FLASH_READ_AHEAD_SIZE > 0
+static void read_ahead_invalidate(const struct flash_area *area)
+{
+    if (read_ahead.driver == DRV_FLASH_AREA(area)) {
+        read_ahead.len = 0;
+        read_ahead.next_addr = 0;
+    }
+}
+
+/*
+ * Serve a read smaller than the read-ahead buffer. The buffer is only refilled
+ * for a read following the previous one, so that the scattered reads of
+ * headers and trailers do not each read a whole buffer.
+ */
+static int read_ahead_read(const struct flash_area *area, uint32_t off,
+                           void *dst, uint32_t len)
+{
+    uint32_t addr = area->fa_off + off;
+    uint32_t fill_len;
+    bool sequential;
+    int ret;
+
+    sequential = (read_ahead.driver == DRV_FLASH_AREA(area)) &&
+                 (addr == read_ahead.next_addr);
+
+    if ((read_ahead.driver != DRV_FLASH_AREA(area)) ||
+        (addr < read_ahead.addr) ||
+        ((addr - read_ahead.addr) > read_ahead.len) ||
+        (len > read_ahead.len - (addr - read_ahead.addr))) {
+        if (!sequential) {
+            read_ahead.driver = DRV_FLASH_AREA(area);
+            read_ahead.next_addr = addr + len;
+            return flash_read(area, off, dst, len);
+        }
+
+        /* The range is valid, so the area holds at least len bytes */
+        fill_len = area->fa_size - off;
+        if (fill_len > BL2_FLASH_READ_AHEAD_SIZE) {
+            fill_len = BL2_FLASH_READ_AHEAD_SIZE;
+        }
+
+        read_ahead.len = 0;
+        ret = flash_read(area, off, read_ahead.buf, fill_len);
+        if (ret != 0) {
+            return ret;
+        }
+        read_ahead.addr = addr;
+        read_ahead.len = fill_len;
+    }
+
+    (void)memcpy(dst, &read_ahead.buf[addr - read_ahead.addr], len);
+    read_ahead.next_addr = addr + len;
+
+    return 0;
+}
+#endif /* BL2_FLASH_READ_AHEAD_SIZE > 0 */
+
+/*
+ * Read/write/erase. Offset is relative from beginning of flash area.
+ * `off` and `len` can be any alignment.
+ * Return 0 on success, other value on failure.
+ */
+int flash_area_read(const struct flash_area *area, uint32_t off, void *dst,
+                    uint32_t len)
+{
+    BOOT_LOG_DBG("read area=%d, off=%#x, len=%#x", area->fa_id, off, len);
+
+    if (!is_range_valid(area, off, len)) {
+        return -1;
+    }
+
+#ifdef BL2_FLASH_MEMORY_MAPPED
+    /* The flash device is readable at FLASH_DEVICE_BASE, skip the driver */
+    if (area->fa_device_id == FLASH_DEVICE_ID) {
+        (void)memcpy(dst,
+                     (const void *)(FLASH_DEVICE_BASE + area->fa_off + off),
+                     len);
+        return 0;
+    }
+#endif /* BL2_FLASH_MEMORY_MAPPED */
+
+#if BL2_FLASH_READ_AHEAD_SIZE > 0
+    if (len < BL2_FLASH_READ_AHEAD_SIZE) {
+        return read_ahead_read(area, off, dst, len);
+    }
+#endif
+
+    return flash_read(area, off, dst, len);
+}
+
 /* Writes `len` bytes of flash memory at `off` from the buffer at `src`.
  * `off` and `len` can be any alignment.
  */
-int flash_area_write(const struct flash_area *area, uint32_t off,
-                     const void *src, uint32_t len)
+static int flash_write(const struct flash_area *area, uint32_t off,
+                       const void *src, uint32_t len)
 {
     uint8_t add_padding[FLASH_PROGRAM_UNIT];
 #if (FLASH_PROGRAM_UNIT == 1)
@@ -377,7 +483,23 @@ int flash_area_write(const struct flash_area *area, uint32_t off,
     return 0;
 }
 
-int flash_area_erase(const struct flash_area *area, uint32_t off, uint32_t len)
+int flash_area_write(const struct flash_area *area, uint32_t off,
+                     const void *src, uint32_t len)
+{
+    int ret = flash_write(area, off, src, len);
+
+#if BL2_FLASH_READ_AHEAD_SIZE > 0
+    /* Also after a failure, the flash content may have changed. The padding
+     * reads of flash_write() may have refilled the buffer with old data.
+     */
+    read_ahead_invalidate(area);
+#endif
+
+    return ret;
+}
+
+static int flash_erase(const struct flash_area *area, uint32_t off,
+                       uint32_t len)
 {
     ARM_FLASH_INFO *flash_info;
     uint32_t deleted_len = 0;
@@ -410,6 +532,17 @@ int flash_area_erase(const struct flash_area *area, uint32_t off, uint32_t len)
     return rc;
 }
 
+int flash_area_erase(const struct flash_area *area, uint32_t off, uint32_t len)
+{
+    int ret = flash_erase(area, off, len);
+
+#if BL2_FLASH_READ_AHEAD_SIZE > 0
+    read_ahead_invalidate(area);
+#endif
+
+    return ret;
+}
+
 uint32_t flash_area_align(const struct flash_area *area)
 {
     ARM_FLASH_INFO *flash_info;
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -19,6 +21,9 @@
 #include "tfm_plat_crypto_keys.h"
 #include "tfm_plat_otp.h"
 #endif /* MCUBOOT_BUILTIN_KEY */
+#ifdef BL2_VERIFY_CACHE
+#include "boot_hal.h"
+#endif /* BL2_VERIFY_CACHE */
 
 /* For mbedtls_psa_ecdsa_verify_hash() */
 #include "psa_crypto_ecp.h"
@@ -40,6 +45,15 @@
 #endif /* MCUBOOT_SIGN_EC256 */
 #endif /* MCUBOOT_BUILTIN_KEY */
 
+#if defined(BL2_VERIFY_CACHE)
+#ifndef BL2_VERIFY_CACHE_ENTRIES
+#define BL2_VERIFY_CACHE_ENTRIES     (MCUBOOT_IMAGE_NUMBER * 2)
+#endif
+#define VERIFY_CACHE_KEY_SIZE        (32)
+#define VERIFY_CACHE_TAG_SIZE        PSA_HASH_LENGTH(PSA_ALG_SHA_256)
+#define VERIFY_CACHE_BLOCK_SIZE      PSA_HASH_BLOCK_LENGTH(PSA_ALG_SHA_256)
+#endif /* BL2_VERIFY_CACHE */
+
 /**
  * @note MCUboot uses the keys by importing them after parsing and then using
  *       them right away in the following call, so it makes sense to avoid a copy
@@ -89,6 +103,23 @@ static struct thin_key_slot_s g_key_slot =  {
 #endif /* !MCUBOOT_BUILTIN_KEY */
 };
 
+#if defined(BL2_VERIFY_CACHE)
+/**
+ * @brief Signature verification cache. Each entry is the HMAC-SHA256, under a
+ *        BL2-only platform key, of a public key, algorithm, hash and signature
+ *        that have been verified successfully. An entry cannot be forged
+ *        without the key, so the cache itself does not need integrity
+ *        protected storage.
+ */
+struct verify_cache_s {
+    uint8_t tag[BL2_VERIFY_CACHE_ENTRIES][VERIFY_CACHE_TAG_SIZE];
+    uint32_t next; /*!< Index of the entry replaced by the next insertion */
+};
+
+static struct verify_cache_s g_verify_cache;
+static bool g_verify_cache_loaded = false;
+#endif /* BL2_VERIFY_CACHE */
+
 /**
  * @brief Context required by the RNG function, mocked
  *
@@ -308,6 +339,158 @@ psa_status_t psa_destroy_key(psa_key_id_t key)
     return PSA_SUCCESS;
 }
 
+#if defined(BL2_VERIFY_CACHE)
+/* Hash a length prefixed field, so that the fields cannot be shifted */
+static psa_status_t verify_cache_hash_field(psa_hash_operation_t *operation,
+                                            const uint8_t *buf,
+                                            size_t len)
+{
+    const uint8_t len_buf[4] = {
+        (uint8_t)len, (uint8_t)(len >> 8),
+        (uint8_t)(len >> 16), (uint8_t)(len >> 24)
+    };
+    psa_status_t status;
+
+    status = psa_hash_update(operation, len_buf, sizeof(len_buf));
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    return psa_hash_update(operation, buf, len);
+}
+
+/* Compute the cache entry of a signature, HMAC-SHA256 over the key slot, the
+ * algorithm, the hash and the signature.
+ */
+static psa_status_t verify_cache_tag(psa_algorithm_t alg,
+                                     const uint8_t *hash,
+                                     size_t hash_length,
+                                     const uint8_t *signature,
+                                     size_t signature_length,
+                                     uint8_t *tag)
+{
+    psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+    uint8_t key[VERIFY_CACHE_KEY_SIZE];
+    uint8_t pad[VERIFY_CACHE_BLOCK_SIZE];
+    const uint8_t alg_buf[4] = {
+        (uint8_t)alg, (uint8_t)(alg >> 8),
+        (uint8_t)(alg >> 16), (uint8_t)(alg >> 24)
+    };
+    size_t tag_length;
+    psa_status_t status;
+    size_t i;
+
+    if (boot_platform_verify_cache_get_key(key, sizeof(key)) != 0) {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+
+    /* Inner hash */
+    memset(pad, 0x36, sizeof(pad));
+    for (i = 0; i < sizeof(key); i++) {
+        pad[i] ^= key[i];
+    }
+
+    status = psa_hash_setup(&operation, PSA_ALG_SHA_256);
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+    status = psa_hash_update(&operation, pad, sizeof(pad));
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+    status = verify_cache_hash_field(&operation, g_key_slot.buf,
+                                     g_key_slot.len);
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+    status = verify_cache_hash_field(&operation, alg_buf, sizeof(alg_buf));
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+    status = verify_cache_hash_field(&operation, hash, hash_length);
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+    status = verify_cache_hash_field(&operation, signature, signature_length);
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+    status = psa_hash_finish(&operation, tag, VERIFY_CACHE_TAG_SIZE,
+                             &tag_length);
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+
+    /* Outer hash */
+    memset(pad, 0x5c, sizeof(pad));
+    for (i = 0; i < sizeof(key); i++) {
+        pad[i] ^= key[i];
+    }
+
+    status = psa_hash_setup(&operation, PSA_ALG_SHA_256);
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+    status = psa_hash_update(&operation, pad, sizeof(pad));
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+    status = psa_hash_update(&operation, tag, VERIFY_CACHE_TAG_SIZE);
+    if (status != PSA_SUCCESS) {
+        goto out;
+    }
+    status = psa_hash_finish(&operation, tag, VERIFY_CACHE_TAG_SIZE,
+                             &tag_length);
+
+out:
+    (void)psa_hash_abort(&operation);
+    memset(key, 0, sizeof(key));
+    memset(pad, 0, sizeof(pad));
+
+    return status;
+}
+
+static bool verify_cache_lookup(const uint8_t *tag)
+{
+    uint8_t diff;
+    bool found = false;
+    size_t i, j;
+
+    if (!g_verify_cache_loaded) {
+        if (boot_platform_verify_cache_read((uint8_t *)&g_verify_cache,
+                                            sizeof(g_verify_cache)) != 0) {
+            memset(&g_verify_cache, 0, sizeof(g_verify_cache));
+        }
+        g_verify_cache_loaded = true;
+    }
+
+    /* Compare the whole of every entry, so that the time taken does not
+     * depend on the content of the cache.
+     */
+    for (i = 0; i < BL2_VERIFY_CACHE_ENTRIES; i++) {
+        diff = 0;
+        for (j = 0; j < VERIFY_CACHE_TAG_SIZE; j++) {
+            diff |= g_verify_cache.tag[i][j] ^ tag[j];
+        }
+        found |= (diff == 0);
+    }
+
+    return found;
+}
+
+static void verify_cache_insert(const uint8_t *tag)
+{
+    uint32_t index = g_verify_cache.next % BL2_VERIFY_CACHE_ENTRIES;
+
+    memcpy(g_verify_cache.tag[index], tag, VERIFY_CACHE_TAG_SIZE);
+    g_verify_cache.next = index + 1;
+
+    /* A failed write only costs a full verification on the next boot */
+    (void)boot_platform_verify_cache_write((const uint8_t *)&g_verify_cache,
+                                           sizeof(g_verify_cache));
+}
+#endif /* BL2_VERIFY_CACHE */
+
 /* Signature verification supports only RSA or ECDSA with P256 or P384 */
 psa_status_t psa_verify_hash(psa_key_id_t key,
                              psa_algorithm_t alg,
@@ -317,6 +500,10 @@ psa_status_t psa_verify_hash(psa_key_id_t key,
                              size_t signature_length)
 {
     psa_status_t status;
+#if defined(BL2_VERIFY_CACHE)
+    uint8_t tag[VERIFY_CACHE_TAG_SIZE];
+    bool tag_valid;
+#endif /* BL2_VERIFY_CACHE */
 
 #if !defined(MCUBOOT_BUILTIN_KEY)
     assert(g_key_slot.is_valid && (g_key_slot.key_id == key));
@@ -330,12 +517,30 @@ psa_status_t psa_verify_hash(psa_key_id_t key,
     }
 #endif /* !MCUBOOT_BUILTIN_KEY */
 
+#if defined(BL2_VERIFY_CACHE)
+    /* The hash still covers the whole image, only the signature check of an
+     * already verified (key, hash, signature) tuple is skipped.
+     */
+    tag_valid = (verify_cache_tag(alg, hash, hash_length,
+                                  signature, signature_length,
+                                  tag) == PSA_SUCCESS);
+    if (tag_valid && verify_cache_lookup(tag)) {
+        return PSA_SUCCESS;
+    }
+#endif /* BL2_VERIFY_CACHE */
+
     status = psa_driver_wrapper_verify_hash(
                 &g_key_slot.attr,
                 g_key_slot.buf, g_key_slot.len,
                 alg, hash, hash_length,
                 signature, signature_length);
 
+#if defined(BL2_VERIFY_CACHE)
+    if ((status == PSA_SUCCESS) && tag_valid) {
+        verify_cache_insert(tag);
+    }
+#endif /* BL2_VERIFY_CACHE */
+
     return status;
 }
 
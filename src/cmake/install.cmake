@@ -1,6 +1,6 @@
 #-------------------------------------------------------------------------------
 # Copyright (c) 2020-2024, Arm Limited. All rights reserved.
-# Copyright (c) 2022-2024 Cypress Semiconductor Corporation (an Infineon company)
+# Copyright (c) 2022-2025 Cypress Semiconductor Corporation (an Infineon company)
 # or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
@@ -135,6 +135,8 @@ endif()
 
 if(TFM_PARTITION_PLATFORM)
     install(FILES       ${INTERFACE_INC_DIR}/tfm_platform_api.h
+                        ${INTERFACE_INC_DIR}/tfm_perf_counters_defs.h
+                        ${INTERFACE_INC_DIR}/tfm_spm_trace_defs.h
             DESTINATION ${INSTALL_INTERFACE_INC_DIR})
 endif()
 
@@ -75,6 +75,11 @@ tfm_invalid_config(TFM_PARTITION_FIRMWARE_UPDATE AND NOT MCUBOOT_DATA_SHARING)
 tfm_invalid_config(NOT (TFM_PARTITION_NS_AGENT_TZ OR TFM_PARTITION_NS_AGENT_MAILBOX))
 tfm_invalid_config(TFM_PLAT_SPECIFIC_MULTI_CORE_COMM AND NOT TFM_PARTITION_NS_AGENT_MAILBOX)
 
+####################### Crypto Partition ###############################
+
+tfm_invalid_config(TFM_PARTITION_CRYPTO_IPC AND NOT TFM_PARTITION_CRYPTO)
+tfm_invalid_config(TFM_PARTITION_CRYPTO_IPC AND NOT CONFIG_TFM_SPM_BACKEND_IPC)
+
 ####################### Protected Storage Partition ###############################
 
 # PS only uses the platform partition when PS_ROLLBACK_PROTECTION is ON, but
@@ -141,6 +141,7 @@ set(TFM_PARTITION_INTERNAL_TRUSTED_STORAGE OFF      CACHE BOOL      "Enable Inte
 set(ITS_ENCRYPTION                   OFF         CACHE BOOL      "Enable authenticated encryption of ITS files using platform specific APIs")
 
 set(TFM_PARTITION_CRYPTO                OFF         CACHE BOOL      "Enable Crypto partition")
+set(TFM_PARTITION_CRYPTO_IPC            OFF         CACHE BOOL      "Build the Crypto partition as an IPC partition with separate fast and slow path services")
 set(CRYPTO_TFM_BUILTIN_KEYS_DRIVER      ON          CACHE BOOL      "Whether to allow crypto service to store builtin keys. Without this, ALL builtin keys must be stored in a platform-specific location")
 
 set(TFM_PARTITION_INITIAL_ATTESTATION   OFF         CACHE BOOL      "Enable Initial Attestation partition")
@@ -177,6 +178,13 @@ else()
     set(MCUBOOT_MEASURED_BOOT OFF)
 endif()
 
+########################## BL2 flash access ####################################
+
+set(BL2_FLASH_READ_AHEAD_SIZE           0           CACHE STRING    "Size of the buffer BL2 fills ahead of sequential flash reads, 0 to disable")
+set(BL2_FLASH_MEMORY_MAPPED             OFF         CACHE BOOL      "BL2 reads the flash device directly from FLASH_BASE_ADDRESS instead of through the flash driver")
+set(BL2_VERIFY_CACHE                    OFF         CACHE BOOL      "BL2 skips the signature check of images whose signature it has already verified")
+set(BL2_IMAGE_TIMING                    OFF         CACHE BOOL      "BL2 records the cycles spent loading and validating each image in the shared data area")
+
 ########################## TF-M Runtime Sanitization ###########################
 
 set(BL1_1_SANITIZE                      OFF         CACHE STRING    "Enable a runtime sanitizer for BL1_1")
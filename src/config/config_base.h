@@ -53,6 +53,24 @@
 #define CRYPTO_RNG_MODULE_ENABLED              1
 #endif
 
+/*
+ * Size in bytes of the reservoir of random bytes generated ahead of time by the
+ * PSA Crypto random number generator module. 0 disables the reservoir.
+ */
+#ifndef CRYPTO_RNG_RESERVOIR_SIZE
+#define CRYPTO_RNG_RESERVOIR_SIZE              0
+#endif
+
+/* Largest random number generation request served from the reservoir */
+#ifndef CRYPTO_RNG_RESERVOIR_MAX_REQUEST
+#define CRYPTO_RNG_RESERVOIR_MAX_REQUEST       32
+#endif
+
+/* Wipe the reservoir bytes as soon as they are handed out */
+#ifndef CRYPTO_RNG_RESERVOIR_BACKTRACKING_RESISTANCE
+#define CRYPTO_RNG_RESERVOIR_BACKTRACKING_RESISTANCE 1
+#endif
+
 /* Enable PSA Crypto Key module */
 #ifndef CRYPTO_KEY_MODULE_ENABLED
 #define CRYPTO_KEY_MODULE_ENABLED              1
@@ -83,6 +101,11 @@
 #define CRYPTO_ASYM_SIGN_MODULE_ENABLED        1
 #endif
 
+/* Enable the PSA Crypto interruptible sign and verify hash operations */
+#ifndef CRYPTO_ASYM_SIGN_INTERRUPTIBLE_ENABLED
+#define CRYPTO_ASYM_SIGN_INTERRUPTIBLE_ENABLED 0
+#endif
+
 /* Enable PSA Crypto asymmetric key encryption module */
 #ifndef CRYPTO_ASYM_ENCRYPT_MODULE_ENABLED
 #define CRYPTO_ASYM_ENCRYPT_MODULE_ENABLED     1
@@ -111,6 +134,31 @@
 #define CRYPTO_SINGLE_PART_FUNCS_DISABLED      0
 #endif
 
+/* Collect per-group cycle statistics in the Crypto partition */
+#ifndef CRYPTO_BENCHMARK_ENABLED
+#define CRYPTO_BENCHMARK_ENABLED               0
+#endif
+
+/* Check the AES, GCM and SHA-256 kernels against known-answer vectors at init */
+#ifndef CRYPTO_ALT_KERNELS_SELF_TEST
+#define CRYPTO_ALT_KERNELS_SELF_TEST           0
+#endif
+
+/* Number of requests between two dumps of the Crypto benchmark statistics */
+#ifndef CRYPTO_BENCHMARK_REPORT_INTERVAL
+#define CRYPTO_BENCHMARK_REPORT_INTERVAL       256
+#endif
+
+/* Sweep each Crypto dispatcher group over payload sizes at init */
+#ifndef CRYPTO_BENCHMARK_DRIVER
+#define CRYPTO_BENCHMARK_DRIVER                0
+#endif
+
+/* Largest payload size of the Crypto benchmark sweep */
+#ifndef CRYPTO_BENCHMARK_DRIVER_MAX_SIZE
+#define CRYPTO_BENCHMARK_DRIVER_MAX_SIZE       1024
+#endif
+
 /* The stack size of the Crypto Secure Partition */
 #ifndef CRYPTO_STACK_SIZE
 #define CRYPTO_STACK_SIZE                      0x1B00
@@ -123,6 +171,62 @@
 #define TFM_FWU_BUF_SIZE                       PSA_FWU_MAX_WRITE_SIZE
 #endif
 
+/*
+ * Hash the image while it is written, so that querying the digest of the
+ * candidate image does not read the staging area back from flash.
+ */
+#ifndef FWU_STREAMING_DIGEST
+#define FWU_STREAMING_DIGEST                   0
+#endif
+
+/*
+ * Size in bytes erased ahead of the write cursor of the staging area. 0 erases
+ * the whole staging area when the update starts.
+ */
+#ifndef FWU_ERASE_AHEAD_SIZE
+#define FWU_ERASE_AHEAD_SIZE                   0
+#endif
+
+/*
+ * Accept delta images, which rebuild the new image from the active image and
+ * a patch. The patch format is described in tfm_fwu_delta.h.
+ */
+#ifndef FWU_DELTA_UPDATE
+#define FWU_DELTA_UPDATE                       0
+#endif
+
+/*
+ * Size of the buffer holding the output of the delta decoder, per component.
+ * It must be a multiple of the write alignment of the staging area.
+ */
+#ifndef FWU_DELTA_BUF_SIZE
+#define FWU_DELTA_BUF_SIZE                     256
+#endif
+
+/*
+ * Accept compressed images, which are decompressed as they are written. The
+ * stream format is described in tfm_fwu_decompress.h.
+ */
+#ifndef FWU_COMPRESSED_UPDATE
+#define FWU_COMPRESSED_UPDATE                  0
+#endif
+
+/*
+ * Largest decompression window accepted, in bits. The window takes
+ * 2^FWU_COMPRESS_WINDOW_BITS bytes per component.
+ */
+#ifndef FWU_COMPRESS_WINDOW_BITS
+#define FWU_COMPRESS_WINDOW_BITS               10
+#endif
+
+/*
+ * Size of the buffer holding the output of the decompressor, per component.
+ * It must be a multiple of the write alignment of the staging area.
+ */
+#ifndef FWU_COMPRESS_BUF_SIZE
+#define FWU_COMPRESS_BUF_SIZE                  256
+#endif
+
 /* The stack size of the Firmware Update Secure Partition */
 #ifndef FWU_STACK_SIZE
 #define FWU_STACK_SIZE                         0x600
@@ -140,6 +244,22 @@
 #define ATTEST_INCLUDE_COSE_KEY_ID             0
 #endif
 
+/*
+ * Size in bytes of the buffer caching the encoded claims which are the same in
+ * every token. 0 disables the cache.
+ */
+#ifndef ATTEST_CLAIM_CACHE_SIZE
+#define ATTEST_CLAIM_CACHE_SIZE                0
+#endif
+
+/*
+ * Maximum number of challenges of a batch request, whose tokens are all signed
+ * by a single signature. 0 disables batch requests.
+ */
+#ifndef ATTEST_BATCH_MAX_CHALLENGES
+#define ATTEST_BATCH_MAX_CHALLENGES            0
+#endif
+
 /* The stack size of the Initial Attestation Secure Partition */
 #ifndef ATTEST_STACK_SIZE
 #define ATTEST_STACK_SIZE                      0x700
@@ -264,6 +384,45 @@
 #define CONFIG_TFM_DOORBELL_API                 0
 #endif
 
+/*
+ * Number of memory ranges recently accepted by the platform that the SPM
+ * accepts again without a platform check, 0 to disable
+ */
+#ifndef CONFIG_TFM_MEM_CHECK_CACHE_ENTRIES
+#define CONFIG_TFM_MEM_CHECK_CACHE_ENTRIES      0
+#endif
+
+/*
+ * Size from which psa_read() and psa_write() copies are done by the platform
+ * DMA while the partition is blocked, 0 to disable
+ */
+#ifndef CONFIG_TFM_SPM_DMA_COPY_THRESHOLD
+#define CONFIG_TFM_SPM_DMA_COPY_THRESHOLD       0
+#endif
+
+/* Number of records in the SPM trace ring, a power of two, 0 to disable */
+#ifndef CONFIG_TFM_SPM_TRACE_ENTRIES
+#define CONFIG_TFM_SPM_TRACE_ENTRIES            0
+#endif
+
+/* Keep runtime counters of the SPM and services, read by the platform service */
+#ifndef CONFIG_TFM_PERF_COUNTERS
+#define CONFIG_TFM_PERF_COUNTERS                0
+#endif
+
+/* Run a service partition at the priority of its highest priority client */
+#ifndef CONFIG_TFM_PRIORITY_INHERITANCE
+#define CONFIG_TFM_PRIORITY_INHERITANCE         0
+#endif
+
+/*
+ * Run the scheduler for SLIH signals from spm_interrupt_tick() instead of after
+ * each interrupt
+ */
+#ifndef CONFIG_TFM_SLIH_COALESCE_SCHEDULE
+#define CONFIG_TFM_SLIH_COALESCE_SCHEDULE       0
+#endif
+
 /* Do not run the scheduler after handling a secure interrupt if the NSPE was pre-empted */
 #ifndef CONFIG_TFM_SCHEDULE_WHEN_NS_INTERRUPTED
 #define CONFIG_TFM_SCHEDULE_WHEN_NS_INTERRUPTED 0
@@ -46,6 +46,13 @@ include(${CMAKE_SOURCE_DIR}/config/tfm_build_log_config.cmake)
 # config/config_base.cmake
 include(${TARGET_PLATFORM_PATH}/post_config.cmake OPTIONAL)
 
+# Derive which manifest of the Crypto partition is used
+if (TFM_PARTITION_CRYPTO AND NOT TFM_PARTITION_CRYPTO_IPC)
+    set(TFM_PARTITION_CRYPTO_SFN ON)
+else()
+    set(TFM_PARTITION_CRYPTO_SFN OFF)
+endif()
+
 # The library to collect compile definitions of config options.
 add_library(tfm_config INTERFACE)
 
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -15,6 +17,7 @@ extern "C" {
 /* Initial Attestation message types that distinguish Attest services. */
 #define TFM_ATTEST_GET_TOKEN       1001
 #define TFM_ATTEST_GET_TOKEN_SIZE  1002
+#define TFM_ATTEST_GET_TOKEN_BATCH 1003
 
 #ifdef __cplusplus
 }
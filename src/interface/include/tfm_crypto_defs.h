@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -59,6 +61,9 @@ struct tfm_crypto_pack_iovec {
     union {
         size_t capacity;     /*!< Key derivation capacity */
         uint64_t value;      /*!< Key derivation integer for update*/
+        uint32_t max_ops;    /*!< Max ops per call of an interruptible
+                              *   operation
+                              */
     };
 };
 
@@ -144,7 +149,15 @@ enum tfm_crypto_group_id_t {
     X(TFM_CRYPTO_ASYMMETRIC_SIGN_MESSAGE)          \
     X(TFM_CRYPTO_ASYMMETRIC_VERIFY_MESSAGE)        \
     X(TFM_CRYPTO_ASYMMETRIC_SIGN_HASH)             \
-    X(TFM_CRYPTO_ASYMMETRIC_VERIFY_HASH)
+    X(TFM_CRYPTO_ASYMMETRIC_VERIFY_HASH)           \
+    X(TFM_CRYPTO_SIGN_HASH_START)                  \
+    X(TFM_CRYPTO_SIGN_HASH_COMPLETE)               \
+    X(TFM_CRYPTO_SIGN_HASH_GET_NUM_OPS)            \
+    X(TFM_CRYPTO_SIGN_HASH_ABORT)                  \
+    X(TFM_CRYPTO_VERIFY_HASH_START)                \
+    X(TFM_CRYPTO_VERIFY_HASH_COMPLETE)             \
+    X(TFM_CRYPTO_VERIFY_HASH_GET_NUM_OPS)          \
+    X(TFM_CRYPTO_VERIFY_HASH_ABORT)
 
 #define ASYM_ENCRYPT_FUNCS                         \
     X(TFM_CRYPTO_ASYMMETRIC_ENCRYPT)               \
@@ -207,6 +220,17 @@ enum tfm_crypto_func_sid_t {
 #define TFM_CRYPTO_GET_GROUP_ID(_function_id) \
     ((enum tfm_crypto_group_id_t)(((uint16_t)(_function_id) >> 8) & 0xFF))
 
+/**
+ * \brief This macro evaluates to true for the groups whose operations complete
+ *        in a short, bounded time (Random, Hash, MAC, Cipher, AEAD). When the
+ *        Crypto partition is built with a separate fast path service, requests
+ *        of these groups are routed to it.
+ */
+#define TFM_CRYPTO_IS_FAST_PATH_GROUP(_group_id)           \
+    (((_group_id) == TFM_CRYPTO_GROUP_ID_RANDOM) ||        \
+     (((_group_id) >= TFM_CRYPTO_GROUP_ID_HASH) &&         \
+      ((_group_id) <= TFM_CRYPTO_GROUP_ID_AEAD)))
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TFM_PERF_COUNTERS_DEFS_H__
+#define __TFM_PERF_COUNTERS_DEFS_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of services and partitions with their own counters */
+#define TFM_PERF_COUNTERS_MAX_SERVICES      32
+#define TFM_PERF_COUNTERS_MAX_PARTITIONS    16
+
+/* Calls to a service, the unused entries have a SID of 0 */
+struct tfm_perf_service_counter_t {
+    uint32_t sid;
+    uint32_t calls;         /* psa_call() from any client                   */
+};
+
+/* Usage of a partition, the unused entries have a partition ID of -1 */
+struct tfm_perf_partition_counter_t {
+    int32_t  partition_id;
+    uint32_t stack_used;    /* Stack high-water mark in bytes, only with
+                             * CONFIG_TFM_STACK_WATERMARKS                  */
+    uint64_t cycles;        /* Cycles between switching to the partition and
+                             * switching away from it                       */
+};
+
+/*
+ * A snapshot of the performance counters, as returned by the platform
+ * service. The counters of a disabled feature stay at 0. All the fields are
+ * little endian.
+ */
+struct tfm_perf_counters_t {
+    uint32_t conn_in_use;           /* Connections allocated from the pool  */
+    uint32_t conn_high_water;
+    uint32_t crypto_oper_in_use;    /* Crypto multipart operation contexts  */
+    uint32_t crypto_oper_high_water;
+    uint32_t its_flash_reads;       /* ITS flash driver operations          */
+    uint32_t its_flash_programs;
+    uint32_t its_flash_erases;
+    uint32_t mailbox_queue_depth;   /* Mailbox messages being handled       */
+    uint32_t mailbox_queue_high_water;
+    uint32_t reserved;
+    struct tfm_perf_service_counter_t services[TFM_PERF_COUNTERS_MAX_SERVICES];
+    struct tfm_perf_partition_counter_t
+                                 partitions[TFM_PERF_COUNTERS_MAX_PARTITIONS];
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TFM_PERF_COUNTERS_DEFS_H__ */
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -12,6 +14,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "psa/client.h"
+#include "tfm_perf_counters_defs.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,6 +30,7 @@ extern "C" {
 #define TFM_PLATFORM_API_ID_NV_INCREMENT  (1011)
 #define TFM_PLATFORM_API_ID_SYSTEM_RESET  (1012)
 #define TFM_PLATFORM_API_ID_IOCTL         (1013)
+#define TFM_PLATFORM_API_ID_PERF_COUNTERS (1014)
 
 /*!
  * \enum tfm_platform_err_t
@@ -93,6 +97,19 @@ enum tfm_platform_err_t
 tfm_platform_nv_counter_read(uint32_t counter_id,
                              uint32_t size, uint8_t *val);
 
+/*!
+ * \brief Reads a snapshot of the runtime performance counters
+ *
+ * \param[out] counters    Pointer to store the counters.
+ *
+ * \return  TFM_PLATFORM_ERR_SUCCESS if the counters are read correctly.
+ *          TFM_PLATFORM_ERR_NOT_SUPPORTED if the secure firmware is built
+ *          without CONFIG_TFM_PERF_COUNTERS. Otherwise, it returns
+ *          TFM_PLATFORM_ERR_SYSTEM_ERROR.
+ */
+enum tfm_platform_err_t
+tfm_platform_perf_counters_read(struct tfm_perf_counters_t *counters);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TFM_SPM_TRACE_DEFS_H__
+#define __TFM_SPM_TRACE_DEFS_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * SPM trace events, with the meaning of their arguments. A connection is
+ * identified by its index in the SPM connection pool, never by its address.
+ */
+#define TFM_SPM_TRACE_PSA_CALL          1   /* SID, connection index        */
+#define TFM_SPM_TRACE_PSA_CALL_RETURN   2   /* status, connection index     */
+#define TFM_SPM_TRACE_PSA_GET           3   /* signal, connection index     */
+#define TFM_SPM_TRACE_PSA_REPLY         4   /* status, connection index     */
+#define TFM_SPM_TRACE_CONTEXT_SWITCH    5   /* previous partition ID, 0     */
+#define TFM_SPM_TRACE_IRQ_ASSERT        6   /* signal, IRQ source           */
+#define TFM_SPM_TRACE_BOUNDARY_SWITCH   7   /* 0, 0                         */
+
+/*
+ * A trace record, as stored by the SPM and returned to readers. All the fields
+ * are little endian.
+ */
+struct tfm_spm_trace_record_t {
+    uint32_t seq;           /* Sequence number of the record               */
+    uint32_t timestamp;     /* Platform timestamp, CPU cycles by default   */
+    uint16_t event;         /* TFM_SPM_TRACE_*                             */
+    int16_t  partition_id;  /* Partition running when the event occurred,
+                             * or the next partition for context switches  */
+    uint32_t arg0;
+    uint32_t arg1;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TFM_SPM_TRACE_DEFS_H__ */
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -55,3 +57,25 @@ psa_initial_attest_get_token_size(size_t  challenge_size,
 
     return status;
 }
+
+psa_status_t
+tfm_initial_attest_get_token_batch(const uint8_t *challenges,
+                                   size_t         challenge_size,
+                                   size_t         challenge_count,
+                                   uint8_t       *token_buf,
+                                   size_t         token_buf_size,
+                                   size_t        *token_sizes)
+{
+    psa_invec in_vec[] = {
+        {&challenge_size, sizeof(challenge_size)},
+        {challenges, challenge_size * challenge_count}
+    };
+    psa_outvec out_vec[] = {
+        {token_buf, token_buf_size},
+        {token_sizes, sizeof(size_t) * challenge_count}
+    };
+
+    return psa_call(TFM_ATTESTATION_SERVICE_HANDLE, TFM_ATTEST_GET_TOKEN_BATCH,
+                    in_vec, IOVEC_LEN(in_vec),
+                    out_vec, IOVEC_LEN(out_vec));
+}
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -13,13 +15,30 @@
 #include "psa/client.h"
 #include "psa_manifest/sid.h"
 
-#define API_DISPATCH(in_vec, out_vec)          \
-    psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL,  \
-             in_vec, IOVEC_LEN(in_vec),        \
+/*
+ * When the Crypto partition provides a fast path service, requests belonging to
+ * the short-running groups are sent to it, so that they are not queued behind
+ * long asymmetric or key derivation operations. The first invec always carries
+ * the tfm_crypto_pack_iovec holding the function ID.
+ */
+#ifdef TFM_CRYPTO_FAST_HANDLE
+#define API_GROUP_ID(in_vec)                                                \
+    TFM_CRYPTO_GET_GROUP_ID(                                                \
+        ((const struct tfm_crypto_pack_iovec *)(in_vec)[0].base)->function_id)
+#define TFM_CRYPTO_API_HANDLE(in_vec)                                       \
+    (TFM_CRYPTO_IS_FAST_PATH_GROUP(API_GROUP_ID(in_vec)) ?                  \
+     TFM_CRYPTO_FAST_HANDLE : TFM_CRYPTO_HANDLE)
+#else
+#define TFM_CRYPTO_API_HANDLE(in_vec) TFM_CRYPTO_HANDLE
+#endif /* TFM_CRYPTO_FAST_HANDLE */
+
+#define API_DISPATCH(in_vec, out_vec)                     \
+    psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL, \
+             in_vec, IOVEC_LEN(in_vec),                   \
              out_vec, IOVEC_LEN(out_vec))
-#define API_DISPATCH_NO_OUTVEC(in_vec)         \
-    psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL,  \
-             in_vec, IOVEC_LEN(in_vec),        \
+#define API_DISPATCH_NO_OUTVEC(in_vec)                    \
+    psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL, \
+             in_vec, IOVEC_LEN(in_vec),                   \
              (psa_outvec *)NULL, 0)
 
 /*!
@@ -729,7 +748,8 @@ TFM_CRYPTO_API(psa_status_t, psa_aead_encrypt)(psa_key_id_t key,
     if (additional_data == NULL) {
         in_len--;
     }
-    status = psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL, in_vec, in_len,
+    status = psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL,
+                      in_vec, in_len,
                       out_vec, IOVEC_LEN(out_vec));
 
     *ciphertext_length = out_vec[0].len;
@@ -790,7 +810,8 @@ TFM_CRYPTO_API(psa_status_t, psa_aead_decrypt)(psa_key_id_t key,
     if (additional_data == NULL) {
         in_len--;
     }
-    status = psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL, in_vec, in_len,
+    status = psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL,
+                      in_vec, in_len,
                       out_vec, IOVEC_LEN(out_vec));
 
     *plaintext_length = out_vec[0].len;
@@ -932,7 +953,8 @@ TFM_CRYPTO_API(psa_status_t, psa_aead_update_ad)(psa_aead_operation_t *operation
     if (input == NULL) {
         in_len--;
     }
-    status = psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL, in_vec, in_len,
+    status = psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL,
+                      in_vec, in_len,
                       NULL, 0);
     return status;
 }
@@ -968,7 +990,8 @@ TFM_CRYPTO_API(psa_status_t, psa_aead_update)(psa_aead_operation_t *operation,
     if (input == NULL) {
         in_len--;
     }
-    status = psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL, in_vec, in_len,
+    status = psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL,
+                      in_vec, in_len,
                       out_vec, IOVEC_LEN(out_vec));
 
     *output_length = out_vec[0].len;
@@ -1012,7 +1035,7 @@ TFM_CRYPTO_API(psa_status_t, psa_aead_finish)(psa_aead_operation_t *operation,
         return PSA_ERROR_INVALID_ARGUMENT;
     }
 
-    status = psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL,
+    status = psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL,
                       in_vec, IOVEC_LEN(in_vec),
                       out_vec, out_len);
 
@@ -1063,7 +1086,7 @@ TFM_CRYPTO_API(psa_status_t, psa_aead_verify)(psa_aead_operation_t *operation,
         return PSA_ERROR_INVALID_ARGUMENT;
     }
 
-    status = psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL,
+    status = psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL,
                       in_vec, IOVEC_LEN(in_vec),
                       out_vec, out_len);
 
@@ -1195,6 +1218,210 @@ TFM_CRYPTO_API(psa_status_t, psa_verify_hash)(psa_key_id_t key,
     return API_DISPATCH_NO_OUTVEC(in_vec);
 }
 
+/* Maximum number of ops performed by each call to an interruptible function.
+ * It is passed along with every request, as the Crypto service is shared by
+ * all clients.
+ */
+static uint32_t interruptible_max_ops = PSA_INTERRUPTIBLE_MAX_OPS_UNLIMITED;
+
+TFM_CRYPTO_API(void, psa_interruptible_set_max_ops)(uint32_t max_ops)
+{
+    interruptible_max_ops = max_ops;
+}
+
+TFM_CRYPTO_API(uint32_t, psa_interruptible_get_max_ops)(void)
+{
+    return interruptible_max_ops;
+}
+
+TFM_CRYPTO_API(uint32_t, psa_sign_hash_get_num_ops)(
+                            const psa_sign_hash_interruptible_operation_t *operation)
+{
+    psa_status_t status;
+    uint32_t num_ops = 0;
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_SIGN_HASH_GET_NUM_OPS_SID,
+        .op_handle = operation->handle,
+    };
+
+    psa_invec in_vec[] = {
+        {.base = &iov, .len = sizeof(struct tfm_crypto_pack_iovec)},
+    };
+    psa_outvec out_vec[] = {
+        {.base = &num_ops, .len = sizeof(uint32_t)},
+    };
+
+    status = API_DISPATCH(in_vec, out_vec);
+    if (status != PSA_SUCCESS) {
+        return 0;
+    }
+
+    return num_ops;
+}
+
+TFM_CRYPTO_API(psa_status_t, psa_sign_hash_start)(
+                            psa_sign_hash_interruptible_operation_t *operation,
+                            psa_key_id_t key,
+                            psa_algorithm_t alg,
+                            const uint8_t *hash,
+                            size_t hash_length)
+{
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_SIGN_HASH_START_SID,
+        .key_id = key,
+        .alg = alg,
+        .op_handle = operation->handle,
+        .max_ops = interruptible_max_ops,
+    };
+
+    psa_invec in_vec[] = {
+        {.base = &iov, .len = sizeof(struct tfm_crypto_pack_iovec)},
+        {.base = hash, .len = hash_length},
+    };
+    psa_outvec out_vec[] = {
+        {.base = &(operation->handle), .len = sizeof(uint32_t)},
+    };
+
+    return API_DISPATCH(in_vec, out_vec);
+}
+
+TFM_CRYPTO_API(psa_status_t, psa_sign_hash_complete)(
+                            psa_sign_hash_interruptible_operation_t *operation,
+                            uint8_t *signature,
+                            size_t signature_size,
+                            size_t *signature_length)
+{
+    psa_status_t status;
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_SIGN_HASH_COMPLETE_SID,
+        .op_handle = operation->handle,
+        .max_ops = interruptible_max_ops,
+    };
+
+    psa_invec in_vec[] = {
+        {.base = &iov, .len = sizeof(struct tfm_crypto_pack_iovec)},
+    };
+    psa_outvec out_vec[] = {
+        {.base = &(operation->handle), .len = sizeof(uint32_t)},
+        {.base = signature, .len = signature_size},
+    };
+
+    status = API_DISPATCH(in_vec, out_vec);
+
+    *signature_length = out_vec[1].len;
+
+    return status;
+}
+
+TFM_CRYPTO_API(psa_status_t, psa_sign_hash_abort)(
+                            psa_sign_hash_interruptible_operation_t *operation)
+{
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_SIGN_HASH_ABORT_SID,
+        .op_handle = operation->handle,
+    };
+
+    psa_invec in_vec[] = {
+        {.base = &iov, .len = sizeof(struct tfm_crypto_pack_iovec)},
+    };
+    psa_outvec out_vec[] = {
+        {.base = &(operation->handle), .len = sizeof(uint32_t)},
+    };
+
+    return API_DISPATCH(in_vec, out_vec);
+}
+
+TFM_CRYPTO_API(uint32_t, psa_verify_hash_get_num_ops)(
+                            const psa_verify_hash_interruptible_operation_t *operation)
+{
+    psa_status_t status;
+    uint32_t num_ops = 0;
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_VERIFY_HASH_GET_NUM_OPS_SID,
+        .op_handle = operation->handle,
+    };
+
+    psa_invec in_vec[] = {
+        {.base = &iov, .len = sizeof(struct tfm_crypto_pack_iovec)},
+    };
+    psa_outvec out_vec[] = {
+        {.base = &num_ops, .len = sizeof(uint32_t)},
+    };
+
+    status = API_DISPATCH(in_vec, out_vec);
+    if (status != PSA_SUCCESS) {
+        return 0;
+    }
+
+    return num_ops;
+}
+
+TFM_CRYPTO_API(psa_status_t, psa_verify_hash_start)(
+                            psa_verify_hash_interruptible_operation_t *operation,
+                            psa_key_id_t key,
+                            psa_algorithm_t alg,
+                            const uint8_t *hash,
+                            size_t hash_length,
+                            const uint8_t *signature,
+                            size_t signature_length)
+{
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_VERIFY_HASH_START_SID,
+        .key_id = key,
+        .alg = alg,
+        .op_handle = operation->handle,
+        .max_ops = interruptible_max_ops,
+    };
+
+    psa_invec in_vec[] = {
+        {.base = &iov, .len = sizeof(struct tfm_crypto_pack_iovec)},
+        {.base = hash, .len = hash_length},
+        {.base = signature, .len = signature_length},
+    };
+    psa_outvec out_vec[] = {
+        {.base = &(operation->handle), .len = sizeof(uint32_t)},
+    };
+
+    return API_DISPATCH(in_vec, out_vec);
+}
+
+TFM_CRYPTO_API(psa_status_t, psa_verify_hash_complete)(
+                            psa_verify_hash_interruptible_operation_t *operation)
+{
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_VERIFY_HASH_COMPLETE_SID,
+        .op_handle = operation->handle,
+        .max_ops = interruptible_max_ops,
+    };
+
+    psa_invec in_vec[] = {
+        {.base = &iov, .len = sizeof(struct tfm_crypto_pack_iovec)},
+    };
+    psa_outvec out_vec[] = {
+        {.base = &(operation->handle), .len = sizeof(uint32_t)},
+    };
+
+    return API_DISPATCH(in_vec, out_vec);
+}
+
+TFM_CRYPTO_API(psa_status_t, psa_verify_hash_abort)(
+                            psa_verify_hash_interruptible_operation_t *operation)
+{
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_VERIFY_HASH_ABORT_SID,
+        .op_handle = operation->handle,
+    };
+
+    psa_invec in_vec[] = {
+        {.base = &iov, .len = sizeof(struct tfm_crypto_pack_iovec)},
+    };
+    psa_outvec out_vec[] = {
+        {.base = &(operation->handle), .len = sizeof(uint32_t)},
+    };
+
+    return API_DISPATCH(in_vec, out_vec);
+}
+
 TFM_CRYPTO_API(psa_status_t, psa_asymmetric_encrypt)(psa_key_id_t key,
                                                      psa_algorithm_t alg,
                                                      const uint8_t *input,
@@ -1232,7 +1459,8 @@ TFM_CRYPTO_API(psa_status_t, psa_asymmetric_encrypt)(psa_key_id_t key,
     if (salt == NULL) {
         in_len--;
     }
-    status = psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL, in_vec, in_len,
+    status = psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL,
+                      in_vec, in_len,
                       out_vec, IOVEC_LEN(out_vec));
 
     *output_length = out_vec[0].len;
@@ -1277,7 +1505,8 @@ TFM_CRYPTO_API(psa_status_t, psa_asymmetric_decrypt)(psa_key_id_t key,
     if (salt == NULL) {
         in_len--;
     }
-    status = psa_call(TFM_CRYPTO_HANDLE, PSA_IPC_CALL, in_vec, in_len,
+    status = psa_call(TFM_CRYPTO_API_HANDLE(in_vec), PSA_IPC_CALL,
+                      in_vec, in_len,
                       out_vec, IOVEC_LEN(out_vec));
 
     *output_length = out_vec[0].len;
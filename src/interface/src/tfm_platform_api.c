@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -107,3 +109,25 @@ tfm_platform_nv_counter_read(uint32_t counter_id,
         return (enum tfm_platform_err_t)status;
     }
 }
+
+enum tfm_platform_err_t
+tfm_platform_perf_counters_read(struct tfm_perf_counters_t *counters)
+{
+    psa_status_t status = PSA_ERROR_CONNECTION_REFUSED;
+    struct psa_outvec out_vec[1];
+
+    out_vec[0].base = counters;
+    out_vec[0].len = sizeof(*counters);
+
+    status = psa_call(TFM_PLATFORM_SERVICE_HANDLE,
+                      TFM_PLATFORM_API_ID_PERF_COUNTERS,
+                      NULL, 0, out_vec, 1);
+
+    if (status == PSA_ERROR_NOT_SUPPORTED) {
+        return TFM_PLATFORM_ERR_NOT_SUPPORTED;
+    } else if (status < PSA_SUCCESS) {
+        return TFM_PLATFORM_ERR_SYSTEM_ERROR;
+    } else {
+        return (enum tfm_platform_err_t)status;
+    }
+}
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2019-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -17,9 +19,14 @@
 #include "fih.h"
 #endif /* CRYPTO_HW_ACCELERATOR */
 
-#ifdef TFM_MEASURED_BOOT_API
+#if defined(TFM_MEASURED_BOOT_API) || defined(BL2_IMAGE_TIMING)
 #include "region_defs.h"
 #include "tfm_boot_status.h"
+#endif /* TFM_MEASURED_BOOT_API || BL2_IMAGE_TIMING */
+#ifdef BL2_IMAGE_TIMING
+#include "bootutil/bootutil_log.h"
+#endif /* BL2_IMAGE_TIMING */
+#ifdef TFM_MEASURED_BOOT_API
 #include "boot_measurement.h"
 #endif /* TFM_MEASURED_BOOT_API */
 
@@ -237,11 +244,20 @@ __WEAK void boot_platform_quit(struct boot_arm_vector_table *vt)
 
 __WEAK int boot_platform_pre_load(uint32_t image_id)
 {
+#ifdef BL2_IMAGE_TIMING
+    boot_image_timing_start(image_id);
+#endif /* BL2_IMAGE_TIMING */
+
     return 0;
 }
 
 __WEAK int boot_platform_post_load(uint32_t image_id)
 {
+#ifdef BL2_IMAGE_TIMING
+    /* The timing is informative only, failing to record it is not fatal */
+    (void)boot_image_timing_stop(image_id);
+#endif /* BL2_IMAGE_TIMING */
+
     return 0;
 }
 
@@ -250,7 +266,7 @@ __WEAK bool boot_platform_should_load_image(uint32_t image_id)
     return true;
 }
 
-#ifdef TFM_MEASURED_BOOT_API
+#if defined(TFM_MEASURED_BOOT_API) || defined(BL2_IMAGE_TIMING)
 static int boot_add_data_to_shared_area(uint8_t        major_type,
                                         uint16_t       minor_type,
                                         size_t         size,
@@ -316,7 +332,9 @@ static int boot_add_data_to_shared_area(uint8_t        major_type,
 
     return 0;
 }
+#endif /* TFM_MEASURED_BOOT_API || BL2_IMAGE_TIMING */
 
+#ifdef TFM_MEASURED_BOOT_API
 __WEAK int boot_store_measurement(
                             uint8_t index,
                             const uint8_t *measurement,
@@ -353,6 +371,57 @@ __WEAK int boot_store_measurement(
 }
 #endif /* TFM_MEASURED_BOOT_API */
 
+#ifdef BL2_IMAGE_TIMING
+static uint32_t image_start_cycles[MCUBOOT_IMAGE_NUMBER];
+
+__WEAK uint32_t boot_platform_get_cycle_count(void)
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+#if defined(DCB_DEMCR_TRCENA_Msk)
+        DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+#else
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#endif
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    return DWT->CYCCNT;
+#else
+    /* No cycle counter on this core, the platform has to provide one */
+    return 0;
+#endif
+}
+
+void boot_image_timing_start(uint32_t image_id)
+{
+    if (image_id < MCUBOOT_IMAGE_NUMBER) {
+        image_start_cycles[image_id] = boot_platform_get_cycle_count();
+    }
+}
+
+int boot_image_timing_stop(uint32_t image_id)
+{
+    uint32_t cycles;
+
+    if (image_id >= MCUBOOT_IMAGE_NUMBER) {
+        return -1;
+    }
+
+    /* Unsigned arithmetic handles a single wrap of the counter */
+    cycles = boot_platform_get_cycle_count() - image_start_cycles[image_id];
+
+    BOOT_LOG_INF("Image %u loaded and validated in %u cycles",
+                 (unsigned int)image_id, (unsigned int)cycles);
+
+    return boot_add_data_to_shared_area(TLV_MAJOR_CORE,
+                                        SET_CORE_MINOR(image_id,
+                                                    CORE_IMAGE_VALIDATION_TIME),
+                                        sizeof(cycles),
+                                        (const uint8_t *)&cycles);
+}
+#endif /* BL2_IMAGE_TIMING */
+
 __WEAK int boot_initiate_recovery_mode(uint32_t image_id)
 {
     (void)image_id;
@@ -360,3 +429,28 @@ __WEAK int boot_initiate_recovery_mode(uint32_t image_id)
     /* We haven't done anything, therefore recovery has failed */
     return 1;
 }
+
+__WEAK int boot_platform_verify_cache_get_key(uint8_t *key, size_t key_size)
+{
+    (void)key;
+    (void)key_size;
+
+    /* No key, the signatures are always verified */
+    return 1;
+}
+
+__WEAK int boot_platform_verify_cache_read(uint8_t *buf, size_t size)
+{
+    (void)buf;
+    (void)size;
+
+    return 1;
+}
+
+__WEAK int boot_platform_verify_cache_write(const uint8_t *buf, size_t size)
+{
+    (void)buf;
+    (void)size;
+
+    return 1;
+}
@@ -14,7 +14,9 @@
 #ifndef IFX_PLATFORM_API
 #define IFX_PLATFORM_API
 
+#include <stddef.h>
 #include "tfm_platform_api.h"
+#include "tfm_spm_trace_defs.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -43,6 +45,29 @@ extern "C" {
  */
 uint32_t ifx_platform_log_msg(const unsigned char *msg, uint32_t msg_size);
 
+/**
+ * \brief Read SPM trace records via Platform service
+ *
+ * The SPM records events in a ring of CONFIG_TFM_SPM_TRACE_ENTRIES records.
+ * Records older than the ring are lost, so the first record returned can
+ * have a larger sequence number than \p seq. Pass the sequence number of the
+ * last record returned plus one to read the following records.
+ *
+ * \param[in]   seq         Sequence number of the first record wanted
+ * \param[out]  records     Buffer receiving the records
+ * \param[in]   count       Number of records the buffer can hold
+ *
+ * The secure image serves this request only when it is built with
+ * IFX_PLATFORM_SPM_TRACE_IOCTL set to 1, as any client can then read the
+ * trace.
+ *
+ * \retval                  Number of records read, 0 if there are no new
+ *                          records or the SPM trace is disabled.
+ */
+size_t ifx_platform_spm_trace_read(uint32_t seq,
+                                   struct tfm_spm_trace_record_t *records,
+                                   size_t count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Cypress Semiconductor Corporation (an Infineon company)
+ * Copyright (c) 2023-2025 Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -52,3 +52,36 @@ uint32_t ifx_platform_log_msg(const uint8_t *msg, uint32_t msg_size)
 
     return out_count;
 }
+
+size_t ifx_platform_spm_trace_read(uint32_t seq,
+                                   struct tfm_spm_trace_record_t *records,
+                                   size_t count)
+{
+    size_t max_chunk = (size_t)PLATFORM_SERVICE_OUTPUT_BUFFER_SIZE /
+                       sizeof(struct tfm_spm_trace_record_t);
+    size_t read_count = 0U;
+
+    while (read_count < count) {
+        size_t chunk = count - read_count;
+        if (chunk > max_chunk) {
+            chunk = max_chunk;
+        }
+
+        psa_invec in_vec = { .base = &seq, .len = sizeof(seq) };
+        psa_outvec out_vec = {
+            .base = &records[read_count],
+            .len = chunk * sizeof(struct tfm_spm_trace_record_t)
+        };
+        enum tfm_platform_err_t status =
+                tfm_platform_ioctl(IFX_PLATFORM_IOCTL_SPM_TRACE_READ,
+                                   &in_vec, &out_vec);
+        if ((status != TFM_PLATFORM_ERR_SUCCESS) || (out_vec.len == 0U)) {
+            break;
+        }
+
+        read_count += out_vec.len / sizeof(struct tfm_spm_trace_record_t);
+        seq = records[read_count - 1U].seq + 1U;
+    }
+
+    return read_count;
+}
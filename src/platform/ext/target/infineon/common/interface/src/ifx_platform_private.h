@@ -34,6 +34,11 @@ extern "C" {
  */
 #define IFX_PLATFORM_IOCTL_PDL_RPC     0x00000001
 
+/**
+ * \brief Read SPM trace records
+ */
+#define IFX_PLATFORM_IOCTL_SPM_TRACE_READ  0x00000002
+
 #ifndef IFX_CUSTOM_PLATFORM_HAL_IOCTL
 #define IFX_CUSTOM_PLATFORM_HAL_IOCTL 0
 #endif
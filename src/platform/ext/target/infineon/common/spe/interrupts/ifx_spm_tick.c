@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdint.h>
+
+#include "config_tfm.h"
+
+#if CONFIG_TFM_SLIH_COALESCE_SCHEDULE == 1
+
+#include "cmsis.h"
+#include "interrupt.h"
+#include "tfm_hal_defs.h"
+#include "tfm_hal_interrupt.h"
+#include "tfm_peripherals_def.h"
+#include "static_checks.h"
+
+#if IFX_IRQ_TEST_TIMER_S_SYSTICK && \
+    (defined(IFX_IRQ_TEST_TIMER_S) || defined(PSA_API_TEST_IPC))
+#error "CONFIG_TFM_SLIH_COALESCE_SCHEDULE uses the SysTick, which is used by the secure IRQ tests"
+#endif
+
+TFM_COVERITY_DEVIATE_LINE(MISRA_C_2023_Rule_8_4, "This definition overrides weak function")
+void SysTick_Handler(void)
+{
+    spm_interrupt_tick();
+}
+
+enum tfm_hal_status_t tfm_hal_spm_tick_init(void)
+{
+    if (SysTick_Config(SystemCoreClock / IFX_SPM_TICK_HZ) != 0u) {
+        return TFM_HAL_ERROR_GENERIC;
+    }
+
+    /* SysTick_Config set the lowest IRQ priority (equal to PendSV), use the
+     * priority of the other secure interrupts instead */
+    NVIC_SetPriority(SysTick_IRQn, DEFAULT_IRQ_PRIORITY);
+
+    return TFM_HAL_SUCCESS;
+}
+
+#endif /* CONFIG_TFM_SLIH_COALESCE_SCHEDULE == 1 */
@@ -6,7 +6,9 @@
  *
  */
 
+#include <string.h>
 #include "cmsis.h"
+#include "config_tfm.h"
 #include "cy_pdl.h"
 #ifdef IFX_PDL_SECURE_SERVICES
 #include "cy_secure_services.h"
@@ -15,6 +17,7 @@
 #include "ifx_platform_private.h"
 #include "platform_svc_api.h"
 #include "tfm_platform_system.h"
+#include "tfm_spm_trace_defs.h"
 
 
 void tfm_platform_hal_system_reset(void)
@@ -67,6 +70,33 @@ enum tfm_platform_err_t tfm_platform_hal_ioctl(tfm_platform_ioctl_req_t request,
         }
 #endif /* IFX_PDL_SECURE_SERVICES */
 
+#if IFX_PLATFORM_SPM_TRACE_IOCTL
+        case IFX_PLATFORM_IOCTL_SPM_TRACE_READ: {
+            uint32_t seq;
+            int32_t count;
+
+            if ((in_vec == NULL) || (in_vec->len != sizeof(seq)) ||
+                (out_vec == NULL)) {
+                status = TFM_PLATFORM_ERR_INVALID_PARAM;
+                break;
+            }
+
+            (void)memcpy(&seq, in_vec->base, sizeof(seq));
+            count = ifx_call_platform_spm_trace_read(seq, out_vec->base,
+                                                     (uint32_t)out_vec->len);
+            if (count < 0) {
+                status = (count == PSA_ERROR_NOT_SUPPORTED) ?
+                         TFM_PLATFORM_ERR_NOT_SUPPORTED :
+                         TFM_PLATFORM_ERR_SYSTEM_ERROR;
+                break;
+            }
+
+            out_vec->len = (size_t)count * sizeof(struct tfm_spm_trace_record_t);
+            status = TFM_PLATFORM_ERR_SUCCESS;
+            break;
+        }
+#endif /* IFX_PLATFORM_SPM_TRACE_IOCTL */
+
         default: {
 #if IFX_CUSTOM_PLATFORM_HAL_IOCTL == 1
             if ((request >= IFX_PLATFORM_IOCTL_APP_MIN) &&
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Cypress Semiconductor Corporation (an Infineon company)
+ * Copyright (c) 2023-2025 Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -36,3 +36,9 @@ __naked void ifx_call_platform_system_reset(void)
     __asm volatile("svc     "M2S(IFX_SVC_PLATFORM_SYSTEM_RESET)"     \n"
                    "bx      lr                                       \n");
 }
+
+__naked int32_t ifx_call_platform_spm_trace_read(uint32_t seq, void *buf, uint32_t size)
+{
+    __asm volatile("svc     "M2S(IFX_SVC_PLATFORM_SPM_TRACE_READ)"   \n"
+                   "bx      lr                                       \n");
+}
@@ -20,6 +20,9 @@
 /* SVC request for system reset to reset the MCU */
 #define IFX_SVC_PLATFORM_SYSTEM_RESET       TFM_SVC_NUM_PLATFORM_THREAD(0x2U)
 
+/* SVC request to read SPM trace records */
+#define IFX_SVC_PLATFORM_SPM_TRACE_READ     TFM_SVC_NUM_PLATFORM_THREAD(0x3U)
+
 /**
  * \brief Enable/disable SysTick for FLIH/SLIH tf-m-tests
  *
@@ -47,4 +50,17 @@ int32_t ifx_call_platform_uart_log(const uint8_t *str, uint32_t len);
  */
 void ifx_call_platform_system_reset(void);
 
+/**
+ * \brief Read SPM trace records
+ *
+ * \param[in]   seq         Sequence number of the first record wanted
+ * \param[out]  buf         Buffer receiving struct tfm_spm_trace_record_t
+ *                          records
+ * \param[in]   size        Buffer size in bytes
+ *
+ * \retval                  Number of records read, or a negative PSA error
+ *                          code
+ */
+int32_t ifx_call_platform_spm_trace_read(uint32_t seq, void *buf, uint32_t size);
+
 #endif /* PLATFORM_SVC_HANDLER_H */
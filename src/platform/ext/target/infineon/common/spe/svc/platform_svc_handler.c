@@ -11,6 +11,7 @@
 #include "cy_device_headers.h"
 #include "platform_svc_api.h"
 #include "spm.h"
+#include "spm_trace.h"
 #include "static_checks.h"
 #include "target_cfg.h"
 #include "tfm_hal_isolation.h"
@@ -81,6 +82,30 @@ static int32_t ifx_svc_platform_system_reset(void)
 #endif
 }
 
+static int32_t ifx_svc_platform_spm_trace_read(uint32_t seq, void *buf, uint32_t size)
+{
+#if CONFIG_TFM_SPM_TRACE_ENTRIES > 0
+    fih_int fih_rc = FIH_FAILURE;
+    struct partition_t *curr_partition = GET_CURRENT_COMPONENT();
+
+    FIH_CALL(tfm_hal_memory_check, fih_rc,
+             curr_partition->boundary, (uintptr_t)buf,
+             (size_t)size, (uint32_t)TFM_HAL_ACCESS_READWRITE);
+    if (fih_not_eq(fih_rc, fih_int_encode(PSA_SUCCESS))) {
+        return PSA_ERROR_PROGRAMMER_ERROR;
+    }
+
+    return (int32_t)spm_trace_read(seq, buf,
+                                   size / sizeof(struct tfm_spm_trace_record_t));
+#else
+    (void)seq;
+    (void)buf;
+    (void)size;
+
+    return (int32_t)PSA_ERROR_NOT_SUPPORTED;
+#endif
+}
+
 TFM_COVERITY_DEVIATE_LINE(MISRA_C_2023_Rule_8_4, "Prototype in tfm_svcalls.c")
 int32_t platform_svc_handlers(uint8_t svc_num, uint32_t *svc_args,
                                 uint32_t lr)
@@ -103,6 +128,12 @@ int32_t platform_svc_handlers(uint8_t svc_num, uint32_t *svc_args,
             retval = ifx_svc_platform_system_reset();
             break;
 
+        case IFX_SVC_PLATFORM_SPM_TRACE_READ:
+            retval = ifx_svc_platform_spm_trace_read(svc_args[0],
+                                                     (void *)svc_args[1],
+                                                     svc_args[2]);
+            break;
+
         default:
             retval = PSA_ERROR_GENERIC_ERROR;
             break;
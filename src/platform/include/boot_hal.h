@@ -1,6 +1,8 @@
 /*
  * Copyright (c) 2019-2024, Arm Limited. All rights reserved.
  * Copyright (c) 2020 STMicroelectronics. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -165,6 +167,73 @@ int boot_store_measurement(uint8_t index,
  */
 int boot_initiate_recovery_mode(uint32_t image_id);
 
+/**
+ * \brief Get the key authenticating the entries of the signature verification
+ *        cache, see BL2_VERIFY_CACHE.
+ *
+ * \note  The key must only be accessible to BL2. The platform is expected to
+ *        lock it before BL2 hands over to the next image. Anyone holding the
+ *        key can make BL2 accept an image without checking its signature.
+ *
+ * \param[out] key       Buffer to hold the key
+ * \param[in]  key_size  Size of the key to retrieve in bytes
+ *
+ * \return Returns 0 on success, non-zero otherwise
+ */
+int boot_platform_verify_cache_get_key(uint8_t *key, size_t key_size);
+
+/**
+ * \brief Read the signature verification cache from non-volatile storage.
+ *
+ * \param[out] buf   Buffer to hold the cache
+ * \param[in]  size  Size of the cache in bytes
+ *
+ * \return Returns 0 on success, non-zero otherwise
+ */
+int boot_platform_verify_cache_read(uint8_t *buf, size_t size);
+
+/**
+ * \brief Write the signature verification cache to non-volatile storage.
+ *        The storage is written once per newly verified image, so it should
+ *        tolerate a write on each update, such as RRAM or a flash sector.
+ *
+ * \param[in] buf   Buffer holding the cache
+ * \param[in] size  Size of the cache in bytes
+ *
+ * \return Returns 0 on success, non-zero otherwise
+ */
+int boot_platform_verify_cache_write(const uint8_t *buf, size_t size);
+
+/**
+ * \brief Get the current value of a free running cycle counter, used to time
+ *        the validation of images, see BL2_IMAGE_TIMING. The default
+ *        implementation uses the DWT cycle counter, if the core has one.
+ *
+ * \return Returns the counter value
+ */
+uint32_t boot_platform_get_cycle_count(void);
+
+/**
+ * \brief Start timing the validation of an image, see BL2_IMAGE_TIMING.
+ *        Called by the default \ref boot_platform_pre_load. A platform
+ *        overriding it calls this function itself to keep the timing.
+ *
+ * \param[in] image_id  The ID of the image that is about to be loaded.
+ */
+void boot_image_timing_start(uint32_t image_id);
+
+/**
+ * \brief Stop timing the validation of an image and add the elapsed cycles to
+ *        the shared data area, see BL2_IMAGE_TIMING. Called by the default
+ *        \ref boot_platform_post_load. A platform overriding it calls this
+ *        function itself to keep the timing.
+ *
+ * \param[in] image_id  The ID of the image that has just been loaded.
+ *
+ * \return Returns 0 on success, non-zero otherwise
+ */
+int boot_image_timing_stop(uint32_t image_id);
+
 #ifdef __cplusplus
 }
 #endif
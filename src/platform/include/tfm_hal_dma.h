@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TFM_HAL_DMA_H__
+#define __TFM_HAL_DMA_H__
+
+#include <stddef.h>
+#include "tfm_hal_defs.h"
+
+/**
+ * \brief  Start copying memory with a DMA controller. Used by the SPM for
+ *         psa_read() and psa_write() copies of at least
+ *         CONFIG_TFM_SPM_DMA_COPY_THRESHOLD bytes.
+ *
+ *         Once the copy is complete, the platform calls
+ *         spm_dma_copy_done() with p_ctx, usually from the DMA interrupt
+ *         handler. The SPM has checked that the calling partition can access
+ *         its buffer, the DMA controller must be able to access both buffers.
+ *
+ * \param[out]  dst     The destination of the copy.
+ * \param[in]   src     The source of the copy.
+ * \param[in]   size    The size of the copy in bytes.
+ * \param[in]   p_ctx   The context to give to spm_dma_copy_done().
+ *
+ * \return  TFM_HAL_SUCCESS - the copy is started.
+ *          Any other value - the copy is not started, for example because
+ *                            no DMA channel is free. The SPM copies the
+ *                            memory itself.
+ */
+enum tfm_hal_status_t tfm_hal_dma_copy_start(void *dst, const void *src,
+                                             size_t size, void *p_ctx);
+
+#endif /* __TFM_HAL_DMA_H__ */
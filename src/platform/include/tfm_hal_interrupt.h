@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2020-2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -44,4 +46,15 @@ enum tfm_hal_status_t tfm_hal_irq_disable(uint32_t irq_num);
  */
 enum tfm_hal_status_t tfm_hal_irq_clear_pending(uint32_t irq_num);
 
+/**
+ * \brief  Starts a periodic secure interrupt whose handler calls
+ *         spm_interrupt_tick(). Only called, and required, with
+ *         CONFIG_TFM_SLIH_COALESCE_SCHEDULE. The period bounds the delay
+ *         before a SLIH partition is scheduled.
+ *
+ * \return  TFM_HAL_ERROR_GENERIC - failed to start the interrupt.
+ *          TFM_HAL_SUCCESS - the interrupt is started.
+ */
+enum tfm_hal_status_t tfm_hal_spm_tick_init(void);
+
 #endif /* __TFM_HAL_INTERRUPT_H__ */
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TFM_CYCLE_COUNTER_H__
+#define __TFM_CYCLE_COUNTER_H__
+
+#include <stdint.h>
+#include "tfm_hal_device_header.h"
+
+/*
+ * The DWT cycle counter is shared by the SPM trace, the SPM performance
+ * counters and the crypto benchmark. It is started on first use and never
+ * reset, the users take snapshots and subtract them. Only privileged code can
+ * read it.
+ */
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+#define TFM_CYCLE_COUNTER_PRESENT       1
+#else
+#define TFM_CYCLE_COUNTER_PRESENT       0
+#endif
+
+/**
+ * \brief   Read the free-running cycle counter, starting it if needed.
+ *
+ * \return  The cycle count, 0 if the core has no cycle counter.
+ */
+static inline uint32_t tfm_cycle_counter_read(void)
+{
+#if TFM_CYCLE_COUNTER_PRESENT
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+#if defined(DCB_DEMCR_TRCENA_Msk)
+        DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+#else
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#endif
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    return DWT->CYCCNT;
+#else
+    return 0;
+#endif
+}
+
+#endif /* __TFM_CYCLE_COUNTER_H__ */
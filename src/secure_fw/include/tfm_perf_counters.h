@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TFM_PERF_COUNTERS_H__
+#define __TFM_PERF_COUNTERS_H__
+
+#include <stdint.h>
+#include "config_tfm.h"
+#include "psa/error.h"
+#include "tfm_perf_counters_defs.h"
+
+/* The counters updated by the partitions owning the resources */
+#define TFM_PERF_CRYPTO_OPER            0U  /* Level, with a high-water mark */
+#define TFM_PERF_ITS_FLASH_READS        1U  /* Event */
+#define TFM_PERF_ITS_FLASH_PROGRAMS     2U  /* Event */
+#define TFM_PERF_ITS_FLASH_ERASES       3U  /* Event */
+#define TFM_PERF_MAILBOX_QUEUE          4U  /* Level, with a high-water mark */
+#define TFM_PERF_COUNTER_ID_COUNT       5U
+
+/* Operations of tfm_perf_counter_update() */
+#define TFM_PERF_OP_INC                 0U
+#define TFM_PERF_OP_DEC                 1U
+#define TFM_PERF_OP_SET                 2U
+
+#if CONFIG_TFM_PERF_COUNTERS
+
+/*
+ * The counters live in the SPM, which updates them for its own resources.
+ * The partitions access them only through SVCs served by the SPM.
+ */
+
+/**
+ * \brief   Update a counter of a resource owned by the calling partition.
+ *          The SPM applies the update in an SVC, the counters are never
+ *          written by the partitions. Not to be called from Handler mode.
+ *
+ * \param[in] id        The counter, one of TFM_PERF_*.
+ * \param[in] op        TFM_PERF_OP_INC, TFM_PERF_OP_DEC or TFM_PERF_OP_SET.
+ * \param[in] value     The new level for TFM_PERF_OP_SET, ignored otherwise.
+ *
+ * \retval PSA_SUCCESS                  The counter is updated.
+ * \retval PSA_ERROR_INVALID_ARGUMENT   Unknown counter or operation.
+ */
+psa_status_t tfm_perf_counter_update(uint32_t id, uint32_t op, uint32_t value);
+
+/**
+ * \brief   Copy the counters to a buffer of the calling partition. The SPM
+ *          brings the stack watermarks up to date first.
+ *
+ * \param[out] counters The buffer.
+ * \param[in]  size     The size of the buffer, sizeof(*counters).
+ *
+ * \retval PSA_SUCCESS                  The counters are copied.
+ * \retval PSA_ERROR_INVALID_ARGUMENT   Wrong size, or the buffer is not
+ *                                      writable by the caller.
+ */
+psa_status_t tfm_perf_counters_read(struct tfm_perf_counters_t *counters,
+                                    uint32_t size);
+
+/* Count an event */
+#define TFM_PERF_COUNTER_INC(id) \
+    ((void)tfm_perf_counter_update((id), TFM_PERF_OP_INC, 0))
+
+/* Allocate or release a resource, keeping track of its highest usage */
+#define TFM_PERF_LEVEL_INC(id) \
+    ((void)tfm_perf_counter_update((id), TFM_PERF_OP_INC, 0))
+#define TFM_PERF_LEVEL_DEC(id) \
+    ((void)tfm_perf_counter_update((id), TFM_PERF_OP_DEC, 0))
+
+/* Set the current usage of a resource */
+#define TFM_PERF_LEVEL_SET(id, value) \
+    ((void)tfm_perf_counter_update((id), TFM_PERF_OP_SET, (value)))
+
+#else /* CONFIG_TFM_PERF_COUNTERS */
+
+#define TFM_PERF_COUNTER_INC(id)                do {} while (0)
+#define TFM_PERF_LEVEL_INC(id)                  do {} while (0)
+#define TFM_PERF_LEVEL_DEC(id)                  do {} while (0)
+#define TFM_PERF_LEVEL_SET(id, value)           do {} while (0)
+
+#endif /* CONFIG_TFM_PERF_COUNTERS */
+
+#endif /* __TFM_PERF_COUNTERS_H__ */
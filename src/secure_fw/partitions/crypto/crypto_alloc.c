@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -11,6 +13,7 @@
 
 #include "config_tfm.h"
 #include "tfm_mbedcrypto_include.h"
+#include "tfm_perf_counters.h"
 
 #include "tfm_crypto_api.h"
 #include "tfm_crypto_defs.h"
@@ -44,6 +47,17 @@ struct tfm_crypto_operation_s {
         psa_hash_operation_t hash;        /*!< Hash operation context */
         psa_key_derivation_operation_t key_deriv; /*!< Key derivation operation context */
         psa_aead_operation_t aead;        /*!< AEAD operation context */
+#if CRYPTO_ASYM_SIGN_INTERRUPTIBLE_ENABLED
+        psa_sign_hash_interruptible_operation_t sign_hash; /*!< Interruptible sign
+                                                            *   hash operation
+                                                            *   context
+                                                            */
+        psa_verify_hash_interruptible_operation_t verify_hash; /*!< Interruptible
+                                                                *   verify hash
+                                                                *   operation
+                                                                *   context
+                                                                */
+#endif
     } operation;
 };
 
@@ -109,6 +123,7 @@ psa_status_t tfm_crypto_operation_alloc(enum tfm_crypto_operation_type type,
             operations[i].type = type;
             *handle = i + 1;
             *ctx = (void *) &(operations[i].operation);
+            TFM_PERF_LEVEL_INC(TFM_PERF_CRYPTO_OPER);
             return PSA_SUCCESS;
         }
     }
@@ -142,6 +157,7 @@ psa_status_t tfm_crypto_operation_release(uint32_t *handle)
         operations[h_val - 1].in_use = TFM_CRYPTO_NOT_IN_USE;
         operations[h_val - 1].type = TFM_CRYPTO_OPERATION_NONE;
         operations[h_val - 1].owner = 0;
+        TFM_PERF_LEVEL_DEC(TFM_PERF_CRYPTO_OPER);
 
         return PSA_SUCCESS;
     }
@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "config_tfm.h"
+
+#if CRYPTO_ALT_KERNELS_SELF_TEST
+
+#include "tfm_mbedcrypto_include.h"
+#include "mbedtls/aes.h"
+#include "mbedtls/sha256.h"
+#if defined(MBEDTLS_GCM_C)
+#include "mbedtls/gcm.h"
+#endif
+
+#include "tfm_crypto_api.h"
+#include "tfm_sp_log.h"
+#if CRYPTO_BENCHMARK_ENABLED
+#include "tfm_cycle_counter.h"
+#endif
+
+/* Number of blocks processed to time a kernel */
+#define CRYPTO_ALT_TIMING_BLOCKS    (256u)
+
+/* Number of bytes processed to time a mode of operation */
+#define CRYPTO_ALT_TIMING_BYTES     (1024u)
+
+#if CRYPTO_BENCHMARK_ENABLED && \
+    (defined(MBEDTLS_CIPHER_MODE_CTR) || defined(MBEDTLS_GCM_C))
+static uint8_t timing_buf[CRYPTO_ALT_TIMING_BYTES];
+#endif
+
+/* The portable decryption runs on the key schedule of mbedtls_aes_setkey_enc() */
+#if !defined(MBEDTLS_AES_DECRYPT_ALT) && !defined(MBEDTLS_AES_SETKEY_DEC_ALT) && \
+    !defined(MBEDTLS_BLOCK_CIPHER_NO_DECRYPT)
+#define CRYPTO_ALT_AES_DECRYPT_TEST
+#endif
+
+#if defined(MBEDTLS_AES_C)
+/* FIPS-197 Appendix C known-answer vectors */
+static const uint8_t aes_kat_plaintext[16] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+};
+
+static const uint8_t aes_kat_key[32] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+};
+
+static const struct {
+    unsigned int keybits;
+    uint8_t ciphertext[16];
+} aes_kats[] = {
+    {128, {0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+           0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a}},
+#if !defined(MBEDTLS_AES_ONLY_128_BIT_KEY_LENGTH)
+    {192, {0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+           0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91}},
+    {256, {0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+           0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89}},
+#endif
+};
+
+static psa_status_t aes_self_test(void)
+{
+    mbedtls_aes_context ctx;
+    uint8_t block[16];
+    psa_status_t status = PSA_SUCCESS;
+    size_t i;
+#if CRYPTO_BENCHMARK_ENABLED
+    uint32_t start, j;
+#endif
+
+    mbedtls_aes_init(&ctx);
+
+    for (i = 0; i < sizeof(aes_kats) / sizeof(aes_kats[0]); i++) {
+        if ((mbedtls_aes_setkey_enc(&ctx, aes_kat_key,
+                                    aes_kats[i].keybits) != 0) ||
+            (mbedtls_aes_crypt_ecb(&ctx, MBEDTLS_AES_ENCRYPT,
+                                   aes_kat_plaintext, block) != 0) ||
+            (memcmp(block, aes_kats[i].ciphertext, sizeof(block)) != 0)) {
+            LOG_ERRFMT("[ERR][Crypto] AES-%u known-answer test failed\r\n",
+                       aes_kats[i].keybits);
+            status = PSA_ERROR_GENERIC_ERROR;
+            break;
+        }
+
+#ifdef CRYPTO_ALT_AES_DECRYPT_TEST
+        if ((mbedtls_aes_setkey_dec(&ctx, aes_kat_key,
+                                    aes_kats[i].keybits) != 0) ||
+            (mbedtls_aes_crypt_ecb(&ctx, MBEDTLS_AES_DECRYPT,
+                                   aes_kats[i].ciphertext, block) != 0) ||
+            (memcmp(block, aes_kat_plaintext, sizeof(block)) != 0)) {
+            LOG_ERRFMT("[ERR][Crypto] AES-%u decryption known-answer test failed\r\n",
+                       aes_kats[i].keybits);
+            status = PSA_ERROR_GENERIC_ERROR;
+            break;
+        }
+
+        (void)mbedtls_aes_setkey_enc(&ctx, aes_kat_key, aes_kats[i].keybits);
+#endif
+
+#if CRYPTO_BENCHMARK_ENABLED
+        start = tfm_cycle_counter_read();
+        for (j = 0; j < CRYPTO_ALT_TIMING_BLOCKS; j++) {
+            (void)mbedtls_aes_crypt_ecb(&ctx, MBEDTLS_AES_ENCRYPT, block, block);
+        }
+        LOG_INFFMT("[INF][Crypto] AES-%u: %u cyc/block\r\n",
+                   aes_kats[i].keybits,
+                   (tfm_cycle_counter_read() - start) / CRYPTO_ALT_TIMING_BLOCKS);
+#endif
+    }
+
+    mbedtls_aes_free(&ctx);
+
+    return status;
+}
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+/* SP 800-38A F.5.1 CTR-AES128.Encrypt, four consecutive counter blocks */
+static const uint8_t ctr_kat_key[16] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+};
+
+static const uint8_t ctr_kat_counter[16] = {
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+};
+
+static const uint8_t ctr_kat_plaintext[64] = {
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+    0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+    0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+    0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+    0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10,
+};
+
+static const uint8_t ctr_kat_ciphertext[64] = {
+    0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26,
+    0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+    0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+    0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+    0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e,
+    0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+    0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1,
+    0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee,
+};
+
+static psa_status_t aes_ctr_self_test(void)
+{
+    mbedtls_aes_context ctx;
+    uint8_t counter[16];
+    uint8_t stream_block[16];
+    uint8_t output[sizeof(ctr_kat_ciphertext)];
+    size_t offset = 0;
+    psa_status_t status = PSA_SUCCESS;
+#if CRYPTO_BENCHMARK_ENABLED
+    uint32_t start;
+#endif
+
+    mbedtls_aes_init(&ctx);
+    (void)memcpy(counter, ctr_kat_counter, sizeof(counter));
+
+    if ((mbedtls_aes_setkey_enc(&ctx, ctr_kat_key, 128) != 0) ||
+        (mbedtls_aes_crypt_ctr(&ctx, sizeof(ctr_kat_plaintext), &offset,
+                               counter, stream_block, ctr_kat_plaintext,
+                               output) != 0) ||
+        (memcmp(output, ctr_kat_ciphertext, sizeof(output)) != 0)) {
+        LOG_ERRFMT("[ERR][Crypto] AES-CTR known-answer test failed\r\n");
+        status = PSA_ERROR_GENERIC_ERROR;
+    }
+
+#if CRYPTO_BENCHMARK_ENABLED
+    if (status == PSA_SUCCESS) {
+        start = tfm_cycle_counter_read();
+        (void)mbedtls_aes_crypt_ctr(&ctx, sizeof(timing_buf), &offset,
+                                    counter, stream_block, timing_buf,
+                                    timing_buf);
+        LOG_INFFMT("[INF][Crypto] AES-128-CTR: %u cyc/byte\r\n",
+                   (tfm_cycle_counter_read() - start) / CRYPTO_ALT_TIMING_BYTES);
+    }
+#endif
+
+    mbedtls_aes_free(&ctx);
+
+    return status;
+}
+#endif /* MBEDTLS_CIPHER_MODE_CTR */
+
+#if defined(MBEDTLS_GCM_C)
+/* Test case 4 of the GCM specification, AES-128 with additional data */
+static const uint8_t gcm_kat_key[16] = {
+    0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+    0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+};
+
+static const uint8_t gcm_kat_iv[12] = {
+    0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+    0xde, 0xca, 0xf8, 0x88,
+};
+
+static const uint8_t gcm_kat_ad[20] = {
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2,
+};
+
+static const uint8_t gcm_kat_plaintext[60] = {
+    0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5,
+    0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+    0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+    0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+    0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53,
+    0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+    0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57,
+    0xba, 0x63, 0x7b, 0x39,
+};
+
+static const uint8_t gcm_kat_ciphertext[60] = {
+    0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24,
+    0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+    0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0,
+    0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+    0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c,
+    0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+    0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97,
+    0x3d, 0x58, 0xe0, 0x91,
+};
+
+static const uint8_t gcm_kat_tag[16] = {
+    0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb,
+    0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47,
+};
+
+static psa_status_t aes_gcm_self_test(void)
+{
+    mbedtls_gcm_context ctx;
+    uint8_t output[sizeof(gcm_kat_ciphertext)];
+    uint8_t tag[sizeof(gcm_kat_tag)];
+    psa_status_t status = PSA_SUCCESS;
+#if CRYPTO_BENCHMARK_ENABLED
+    uint32_t start;
+#endif
+
+    mbedtls_gcm_init(&ctx);
+
+    if ((mbedtls_gcm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, gcm_kat_key,
+                            128) != 0) ||
+        (mbedtls_gcm_crypt_and_tag(&ctx, MBEDTLS_GCM_ENCRYPT,
+                                   sizeof(gcm_kat_plaintext),
+                                   gcm_kat_iv, sizeof(gcm_kat_iv),
+                                   gcm_kat_ad, sizeof(gcm_kat_ad),
+                                   gcm_kat_plaintext, output,
+                                   sizeof(tag), tag) != 0) ||
+        (memcmp(output, gcm_kat_ciphertext, sizeof(output)) != 0) ||
+        (memcmp(tag, gcm_kat_tag, sizeof(tag)) != 0) ||
+        (mbedtls_gcm_auth_decrypt(&ctx, sizeof(gcm_kat_ciphertext),
+                                  gcm_kat_iv, sizeof(gcm_kat_iv),
+                                  gcm_kat_ad, sizeof(gcm_kat_ad),
+                                  gcm_kat_tag, sizeof(gcm_kat_tag),
+                                  gcm_kat_ciphertext, output) != 0) ||
+        (memcmp(output, gcm_kat_plaintext, sizeof(output)) != 0)) {
+        LOG_ERRFMT("[ERR][Crypto] AES-GCM known-answer test failed\r\n");
+        status = PSA_ERROR_GENERIC_ERROR;
+    }
+
+#if CRYPTO_BENCHMARK_ENABLED
+    if (status == PSA_SUCCESS) {
+        start = tfm_cycle_counter_read();
+        (void)mbedtls_gcm_crypt_and_tag(&ctx, MBEDTLS_GCM_ENCRYPT,
+                                        sizeof(timing_buf),
+                                        gcm_kat_iv, sizeof(gcm_kat_iv),
+                                        NULL, 0, timing_buf, timing_buf,
+                                        sizeof(tag), tag);
+        LOG_INFFMT("[INF][Crypto] AES-128-GCM: %u cyc/byte\r\n",
+                   (tfm_cycle_counter_read() - start) / CRYPTO_ALT_TIMING_BYTES);
+    }
+#endif
+
+    mbedtls_gcm_free(&ctx);
+
+    return status;
+}
+#endif /* MBEDTLS_GCM_C */
+#endif /* MBEDTLS_AES_C */
+
+#if defined(MBEDTLS_SHA256_C)
+/* FIPS 180-2 Appendix B known-answer vectors, one and two blocks */
+static const struct {
+    const char *msg;
+    uint8_t digest[32];
+} sha256_kats[] = {
+    {"abc",
+     {0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+      0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+      0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+      0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad}},
+    {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+     {0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8,
+      0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+      0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67,
+      0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1}},
+};
+
+static psa_status_t sha256_self_test(void)
+{
+    uint8_t digest[32];
+    size_t i;
+#if CRYPTO_BENCHMARK_ENABLED
+    mbedtls_sha256_context ctx;
+    uint8_t block[64] = {0};
+    uint32_t start, j;
+#endif
+
+    for (i = 0; i < sizeof(sha256_kats) / sizeof(sha256_kats[0]); i++) {
+        if ((mbedtls_sha256((const unsigned char *)sha256_kats[i].msg,
+                            strlen(sha256_kats[i].msg), digest, 0) != 0) ||
+            (memcmp(digest, sha256_kats[i].digest, sizeof(digest)) != 0)) {
+            LOG_ERRFMT("[ERR][Crypto] SHA-256 known-answer test %u failed\r\n",
+                       (uint32_t)i);
+            return PSA_ERROR_GENERIC_ERROR;
+        }
+    }
+
+#if CRYPTO_BENCHMARK_ENABLED
+    mbedtls_sha256_init(&ctx);
+    (void)mbedtls_sha256_starts(&ctx, 0);
+    start = tfm_cycle_counter_read();
+    for (j = 0; j < CRYPTO_ALT_TIMING_BLOCKS; j++) {
+        (void)mbedtls_sha256_update(&ctx, block, sizeof(block));
+    }
+    LOG_INFFMT("[INF][Crypto] SHA-256: %u cyc/block\r\n",
+               (tfm_cycle_counter_read() - start) / CRYPTO_ALT_TIMING_BLOCKS);
+    mbedtls_sha256_free(&ctx);
+#endif
+
+    return PSA_SUCCESS;
+}
+#endif /* MBEDTLS_SHA256_C */
+
+psa_status_t tfm_crypto_alt_kernels_self_test(void)
+{
+    psa_status_t status = PSA_SUCCESS;
+
+#if defined(MBEDTLS_AES_C)
+    status = aes_self_test();
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+    status = aes_ctr_self_test();
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+#endif
+
+#if defined(MBEDTLS_GCM_C)
+    status = aes_gcm_self_test();
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+#endif
+#endif /* MBEDTLS_AES_C */
+
+#if defined(MBEDTLS_SHA256_C)
+    status = sha256_self_test();
+#endif
+
+    return status;
+}
+
+#endif /* CRYPTO_ALT_KERNELS_SELF_TEST */
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -24,6 +26,145 @@
 
 /*!@{*/
 #if CRYPTO_ASYM_SIGN_MODULE_ENABLED
+#if CRYPTO_ASYM_SIGN_INTERRUPTIBLE_ENABLED
+static psa_status_t tfm_crypto_interruptible_sign_interface(
+                                        psa_invec in_vec[],
+                                        psa_outvec out_vec[],
+                                        tfm_crypto_library_key_id_t library_key)
+{
+    const struct tfm_crypto_pack_iovec *iov = in_vec[0].base;
+    enum tfm_crypto_func_sid_t sid = (enum tfm_crypto_func_sid_t)iov->function_id;
+    enum tfm_crypto_operation_type type = TFM_CRYPTO_SIGN_HASH_OPERATION;
+    psa_sign_hash_interruptible_operation_t *sign_operation = NULL;
+    psa_verify_hash_interruptible_operation_t *verify_operation = NULL;
+    void *operation = NULL;
+    uint32_t *p_handle = NULL;
+    psa_status_t status;
+
+    if (sid >= TFM_CRYPTO_VERIFY_HASH_START_SID) {
+        type = TFM_CRYPTO_VERIFY_HASH_OPERATION;
+    }
+
+    if ((sid == TFM_CRYPTO_SIGN_HASH_GET_NUM_OPS_SID) ||
+        (sid == TFM_CRYPTO_VERIFY_HASH_GET_NUM_OPS_SID)) {
+        uint32_t *num_ops = out_vec[0].base;
+
+        if ((out_vec[0].base == NULL) || (out_vec[0].len < sizeof(uint32_t))) {
+            return PSA_ERROR_PROGRAMMER_ERROR;
+        }
+        status = tfm_crypto_operation_lookup(type, iov->op_handle, &operation);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+        if (type == TFM_CRYPTO_SIGN_HASH_OPERATION) {
+            *num_ops = psa_sign_hash_get_num_ops(operation);
+        } else {
+            *num_ops = psa_verify_hash_get_num_ops(operation);
+        }
+        return PSA_SUCCESS;
+    }
+
+    /* All the other functions put the handle in out_vec[0] */
+    p_handle = out_vec[0].base;
+    if ((out_vec[0].base == NULL) || (out_vec[0].len < sizeof(uint32_t))) {
+        return PSA_ERROR_PROGRAMMER_ERROR;
+    }
+    *p_handle = iov->op_handle;
+
+    if ((sid == TFM_CRYPTO_SIGN_HASH_START_SID) ||
+        (sid == TFM_CRYPTO_VERIFY_HASH_START_SID)) {
+        status = tfm_crypto_operation_alloc(type, p_handle, &operation);
+    } else {
+        status = tfm_crypto_operation_lookup(type, iov->op_handle, &operation);
+    }
+    if (status != PSA_SUCCESS) {
+        if ((sid == TFM_CRYPTO_SIGN_HASH_ABORT_SID) ||
+            (sid == TFM_CRYPTO_VERIFY_HASH_ABORT_SID)) {
+            /* The abort functions can be called multiple times */
+            return PSA_SUCCESS;
+        }
+        return status;
+    }
+    sign_operation = operation;
+    verify_operation = operation;
+
+    /* The limit is global to the library, set it for the caller at each step */
+    psa_interruptible_set_max_ops(iov->max_ops);
+
+    switch (sid) {
+    case TFM_CRYPTO_SIGN_HASH_START_SID:
+    {
+        const uint8_t *hash = in_vec[1].base;
+        size_t hash_length = in_vec[1].len;
+
+        status = psa_sign_hash_start(sign_operation, library_key, iov->alg,
+                                     hash, hash_length);
+        if (status != PSA_SUCCESS) {
+            goto release_operation_and_return;
+        }
+    }
+    break;
+    case TFM_CRYPTO_SIGN_HASH_COMPLETE_SID:
+    {
+        uint8_t *signature = out_vec[1].base;
+        size_t signature_size = out_vec[1].len;
+
+        status = psa_sign_hash_complete(sign_operation, signature,
+                                        signature_size, &out_vec[1].len);
+        if (status != PSA_SUCCESS) {
+            out_vec[1].len = 0;
+        }
+        if (status != PSA_OPERATION_INCOMPLETE) {
+            goto release_operation_and_return;
+        }
+    }
+    break;
+    case TFM_CRYPTO_SIGN_HASH_ABORT_SID:
+    {
+        status = psa_sign_hash_abort(sign_operation);
+        goto release_operation_and_return;
+    }
+    case TFM_CRYPTO_VERIFY_HASH_START_SID:
+    {
+        const uint8_t *hash = in_vec[1].base;
+        size_t hash_length = in_vec[1].len;
+        const uint8_t *signature = in_vec[2].base;
+        size_t signature_length = in_vec[2].len;
+
+        status = psa_verify_hash_start(verify_operation, library_key, iov->alg,
+                                       hash, hash_length,
+                                       signature, signature_length);
+        if (status != PSA_SUCCESS) {
+            goto release_operation_and_return;
+        }
+    }
+    break;
+    case TFM_CRYPTO_VERIFY_HASH_COMPLETE_SID:
+    {
+        status = psa_verify_hash_complete(verify_operation);
+        if (status != PSA_OPERATION_INCOMPLETE) {
+            goto release_operation_and_return;
+        }
+    }
+    break;
+    case TFM_CRYPTO_VERIFY_HASH_ABORT_SID:
+    {
+        status = psa_verify_hash_abort(verify_operation);
+        goto release_operation_and_return;
+    }
+    default:
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+
+    return status;
+
+release_operation_and_return:
+    /* Release the operation context, ignore if the release fails. */
+    (void)tfm_crypto_operation_release(p_handle);
+    return status;
+}
+#endif /* CRYPTO_ASYM_SIGN_INTERRUPTIBLE_ENABLED */
+
 psa_status_t tfm_crypto_asymmetric_sign_interface(psa_invec in_vec[],
                                                   psa_outvec out_vec[],
                                                   struct tfm_crypto_key_id_s *encoded_key)
@@ -82,6 +223,20 @@ psa_status_t tfm_crypto_asymmetric_sign_interface(psa_invec in_vec[],
         return psa_verify_hash(library_key, iov->alg, hash, hash_length,
                                signature, signature_length);
     }
+    case TFM_CRYPTO_SIGN_HASH_START_SID:
+    case TFM_CRYPTO_SIGN_HASH_COMPLETE_SID:
+    case TFM_CRYPTO_SIGN_HASH_GET_NUM_OPS_SID:
+    case TFM_CRYPTO_SIGN_HASH_ABORT_SID:
+    case TFM_CRYPTO_VERIFY_HASH_START_SID:
+    case TFM_CRYPTO_VERIFY_HASH_COMPLETE_SID:
+    case TFM_CRYPTO_VERIFY_HASH_GET_NUM_OPS_SID:
+    case TFM_CRYPTO_VERIFY_HASH_ABORT_SID:
+#if CRYPTO_ASYM_SIGN_INTERRUPTIBLE_ENABLED
+        return tfm_crypto_interruptible_sign_interface(in_vec, out_vec,
+                                                       library_key);
+#else
+        return PSA_ERROR_NOT_SUPPORTED;
+#endif
     default:
         return PSA_ERROR_NOT_SUPPORTED;
     }
@@ -0,0 +1,553 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "config_tfm.h"
+
+#if CRYPTO_BENCHMARK_ENABLED
+
+#include "tfm_hal_device_header.h"
+#include "tfm_crypto_defs.h"
+#include "tfm_cycle_counter.h"
+#include "tfm_sp_log.h"
+#include "crypto_benchmark.h"
+#if CRYPTO_BENCHMARK_DRIVER
+#include "tfm_mbedcrypto_include.h"
+#include "tfm_crypto_api.h"
+#endif
+
+#if !TFM_CYCLE_COUNTER_PRESENT
+#error "CRYPTO_BENCHMARK_ENABLED requires a core with the DWT cycle counter"
+#endif
+
+/* The cycle counter is only readable by privileged code */
+#if (TFM_ISOLATION_LEVEL == 3) || \
+    ((TFM_ISOLATION_LEVEL == 2) && \
+     !(defined(IFX_PSA_ROT_PRIVILEGED) && IFX_PSA_ROT_PRIVILEGED))
+#error "CRYPTO_BENCHMARK_ENABLED requires the PSA RoT partitions to be privileged"
+#endif
+
+#if TFM_PARTITION_LOG_LEVEL < TFM_PARTITION_LOG_LEVEL_INFO
+#error "CRYPTO_BENCHMARK_ENABLED requires TFM_PARTITION_LOG_LEVEL of INFO or above"
+#endif
+
+/**
+ * \brief Highest group ID tracked, \ref tfm_crypto_group_id_t
+ */
+#define CRYPTO_BENCHMARK_MAX_GROUP_ID TFM_CRYPTO_GROUP_ID_KEY_DERIVATION
+
+/**
+ * \brief Payload size of the first size class, each following class is four
+ *        times larger than the previous one
+ */
+#define CRYPTO_BENCHMARK_FIRST_CLASS_SIZE (16u)
+
+/**
+ * \brief Statistics collected for a (group, payload size class) pair
+ */
+struct crypto_benchmark_stats_t {
+    uint32_t calls;            /*!< Number of requests processed */
+    uint64_t bytes;            /*!< Payload bytes consumed and produced */
+    uint64_t total_cycles;     /*!< Cycles from message receipt to return */
+    uint64_t primitive_cycles; /*!< Cycles spent in the group interface */
+};
+
+static struct crypto_benchmark_stats_t
+    stats[CRYPTO_BENCHMARK_MAX_GROUP_ID + 1][CRYPTO_BENCHMARK_SIZE_CLASSES];
+
+/* Timestamps of the request currently in flight */
+static uint32_t t_request;
+static uint32_t t_primitive;
+static uint32_t primitive_cycles;
+
+static uint32_t nr_requests;
+
+static const char *const group_names[CRYPTO_BENCHMARK_MAX_GROUP_ID + 1] = {
+    [TFM_CRYPTO_GROUP_ID_RANDOM]         = "RNG",
+    [TFM_CRYPTO_GROUP_ID_KEY_MANAGEMENT] = "KEY",
+    [TFM_CRYPTO_GROUP_ID_HASH]           = "HASH",
+    [TFM_CRYPTO_GROUP_ID_MAC]            = "MAC",
+    [TFM_CRYPTO_GROUP_ID_CIPHER]         = "CIPHER",
+    [TFM_CRYPTO_GROUP_ID_AEAD]           = "AEAD",
+    [TFM_CRYPTO_GROUP_ID_ASYM_SIGN]      = "SIGN",
+    [TFM_CRYPTO_GROUP_ID_ASYM_ENCRYPT]   = "ENCRYPT",
+    [TFM_CRYPTO_GROUP_ID_KEY_DERIVATION] = "DERIVE",
+};
+
+static inline uint32_t cycles_now(void)
+{
+    return tfm_cycle_counter_read();
+}
+
+static uint32_t size_class(size_t payload)
+{
+    uint32_t cls = 0;
+    size_t limit = CRYPTO_BENCHMARK_FIRST_CLASS_SIZE;
+
+    while ((cls < (CRYPTO_BENCHMARK_SIZE_CLASSES - 1)) && (payload >= limit)) {
+        limit <<= 2;
+        cls++;
+    }
+
+    return cls;
+}
+
+void tfm_crypto_benchmark_init(void)
+{
+    (void)memset(stats, 0, sizeof(stats));
+    nr_requests = 0;
+
+    /*
+     * Start the counter now so that the first request is timed. It is shared
+     * with the SPM, never reset it.
+     */
+    (void)tfm_cycle_counter_read();
+}
+
+void tfm_crypto_benchmark_request_begin(void)
+{
+    primitive_cycles = 0;
+    t_request = cycles_now();
+}
+
+void tfm_crypto_benchmark_primitive_begin(void)
+{
+    t_primitive = cycles_now();
+}
+
+void tfm_crypto_benchmark_primitive_end(void)
+{
+    /* Unsigned arithmetic takes care of a single counter wrap */
+    primitive_cycles = cycles_now() - t_primitive;
+}
+
+void tfm_crypto_benchmark_request_end(uint16_t function_id,
+                                      const psa_invec in_vec[],
+                                      size_t in_len,
+                                      const psa_outvec out_vec[],
+                                      size_t out_len)
+{
+    uint32_t total_cycles = cycles_now() - t_request;
+    enum tfm_crypto_group_id_t group_id = TFM_CRYPTO_GET_GROUP_ID(function_id);
+    struct crypto_benchmark_stats_t *p_stats;
+    size_t payload = 0;
+    size_t i;
+
+    if (group_id > CRYPTO_BENCHMARK_MAX_GROUP_ID) {
+        return;
+    }
+
+    /* The first invec always holds the packed parameters, not payload */
+    for (i = 1; i < in_len; i++) {
+        payload += in_vec[i].len;
+    }
+
+    for (i = 0; i < out_len; i++) {
+        payload += out_vec[i].len;
+    }
+
+    p_stats = &stats[group_id][size_class(payload)];
+    p_stats->calls++;
+    p_stats->bytes += payload;
+    p_stats->total_cycles += total_cycles;
+    p_stats->primitive_cycles += primitive_cycles;
+
+    if (++nr_requests >= CRYPTO_BENCHMARK_REPORT_INTERVAL) {
+        tfm_crypto_benchmark_dump();
+    }
+}
+
+void tfm_crypto_benchmark_dump(void)
+{
+    const struct crypto_benchmark_stats_t *p_stats;
+    uint32_t group_id, cls, avg_total, avg_dispatch, cycles_per_byte;
+    uint32_t calls_per_sec;
+    uint32_t limit;
+
+    LOG_INFFMT("[INF][Crypto] Benchmark over %u requests @ %u Hz\r\n",
+               nr_requests, SystemCoreClock);
+
+    for (group_id = TFM_CRYPTO_GROUP_ID_RANDOM;
+         group_id <= CRYPTO_BENCHMARK_MAX_GROUP_ID; group_id++) {
+        limit = CRYPTO_BENCHMARK_FIRST_CLASS_SIZE;
+        for (cls = 0; cls < CRYPTO_BENCHMARK_SIZE_CLASSES; cls++, limit <<= 2) {
+            p_stats = &stats[group_id][cls];
+            if (p_stats->calls == 0) {
+                continue;
+            }
+
+            avg_total = (uint32_t)(p_stats->total_cycles / p_stats->calls);
+            avg_dispatch = (uint32_t)((p_stats->total_cycles -
+                                       p_stats->primitive_cycles) /
+                                      p_stats->calls);
+            cycles_per_byte = (p_stats->bytes != 0) ?
+                (uint32_t)(p_stats->primitive_cycles / p_stats->bytes) : 0;
+            calls_per_sec = (avg_total != 0) ? (SystemCoreClock / avg_total) : 0;
+
+            if (cls < (CRYPTO_BENCHMARK_SIZE_CLASSES - 1)) {
+                LOG_INFFMT("[INF][Crypto] %s <%u B: ", group_names[group_id],
+                           limit);
+            } else {
+                LOG_INFFMT("[INF][Crypto] %s >=%u B: ", group_names[group_id],
+                           limit >> 2);
+            }
+            LOG_INFFMT("%u calls, %u cyc/call (%u dispatch), %u cyc/B, %u calls/s\r\n",
+                       p_stats->calls, avg_total, avg_dispatch,
+                       cycles_per_byte, calls_per_sec);
+        }
+    }
+
+    (void)memset(stats, 0, sizeof(stats));
+    nr_requests = 0;
+}
+
+#if CRYPTO_BENCHMARK_DRIVER
+/**
+ * \brief Payload size of the first point of the sweep, each following point
+ *        is four times larger than the previous one
+ */
+#define CRYPTO_BENCHMARK_DRIVER_FIRST_SIZE (16u)
+
+/**
+ * \brief Number of requests timed for each point of the sweep
+ */
+#define CRYPTO_BENCHMARK_DRIVER_ITERATIONS (8u)
+
+/**
+ * \brief Room left in the output buffer for an IV, a tag or a digest
+ */
+#define CRYPTO_BENCHMARK_DRIVER_OUT_EXTRA  (64u)
+
+/**
+ * \brief Size of the key attributes as packed by the client API, which does
+ *        not carry the owner
+ */
+#define CRYPTO_BENCHMARK_DRIVER_ATTR_SIZE \
+    (sizeof(psa_key_attributes_t) - sizeof(mbedtls_key_owner_id_t))
+
+static uint8_t driver_in[CRYPTO_BENCHMARK_DRIVER_MAX_SIZE];
+static uint8_t driver_out[CRYPTO_BENCHMARK_DRIVER_MAX_SIZE +
+                          CRYPTO_BENCHMARK_DRIVER_OUT_EXTRA];
+
+/* Cycles of the last request dispatched by the driver */
+static uint32_t driver_cycles;
+
+/**
+ * \brief Dispatch a request packed the way the client API packs it, with at
+ *        most two input and one output payload, and time it
+ */
+static psa_status_t driver_dispatch(struct tfm_crypto_pack_iovec *iov,
+                                    const void *in1, size_t in1_len,
+                                    const void *in2, size_t in2_len,
+                                    void *out, size_t out_len)
+{
+    psa_invec in_vec[PSA_MAX_IOVEC] = {
+        {.base = iov, .len = sizeof(*iov)},
+        {.base = in1, .len = in1_len},
+        {.base = in2, .len = in2_len},
+    };
+    psa_outvec out_vec[PSA_MAX_IOVEC] = {
+        {.base = out, .len = out_len},
+    };
+    size_t in_len = (in2 != NULL) ? 3 : ((in1 != NULL) ? 2 : 1);
+    psa_status_t status;
+    uint32_t start;
+
+    primitive_cycles = 0;
+    start = cycles_now();
+    status = tfm_crypto_api_dispatcher(in_vec, in_len,
+                                       out_vec, (out != NULL) ? 1 : 0);
+    driver_cycles = cycles_now() - start;
+
+    return status;
+}
+
+/**
+ * \brief Print a point of the sweep as cycles per call, dispatch cycles and
+ *        MB/s
+ */
+static void driver_print_point(const char *name, size_t payload,
+                               uint32_t cycles, uint32_t dispatch_cycles)
+{
+    uint32_t mbps_x100 = 0;
+
+    if (cycles != 0) {
+        mbps_x100 = (uint32_t)(((uint64_t)payload * SystemCoreClock) /
+                               ((uint64_t)cycles * 10000u));
+    }
+
+    LOG_INFFMT("[INF][Crypto] %s %u B: %u cyc/call (%u dispatch), %u.%02u MB/s\r\n",
+               name, (uint32_t)payload, cycles, dispatch_cycles,
+               mbps_x100 / 100u, mbps_x100 % 100u);
+}
+
+/**
+ * \brief Time a request of the given payload size over a number of
+ *        iterations and print the averages
+ */
+static void driver_run_point(const char *name,
+                             const struct tfm_crypto_pack_iovec *iov,
+                             const void *in, size_t in_len,
+                             void *out, size_t out_len,
+                             size_t payload)
+{
+    struct tfm_crypto_pack_iovec iov_copy;
+    uint64_t total = 0, primitive = 0;
+    psa_status_t status;
+    uint32_t i;
+
+    for (i = 0; i < CRYPTO_BENCHMARK_DRIVER_ITERATIONS; i++) {
+        /* The dispatcher may update the packed parameters */
+        iov_copy = *iov;
+        status = driver_dispatch(&iov_copy, in, in_len, NULL, 0,
+                                 out, out_len);
+        if (status != PSA_SUCCESS) {
+            LOG_INFFMT("[INF][Crypto] %s %u B: status %d\r\n", name,
+                       (uint32_t)payload, (int)status);
+            return;
+        }
+        total += driver_cycles;
+        primitive += primitive_cycles;
+    }
+
+    driver_print_point(name, payload,
+                       (uint32_t)(total / CRYPTO_BENCHMARK_DRIVER_ITERATIONS),
+                       (uint32_t)((total - primitive) /
+                                  CRYPTO_BENCHMARK_DRIVER_ITERATIONS));
+}
+
+/**
+ * \brief Import a key through the dispatcher, for the calling partition
+ */
+static psa_status_t driver_import_key(psa_key_type_t type, size_t bits,
+                                      psa_key_usage_t usage,
+                                      psa_algorithm_t alg,
+                                      const uint8_t *data, size_t data_len,
+                                      psa_key_id_t *p_key)
+{
+    psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_IMPORT_KEY_SID,
+    };
+
+    psa_set_key_type(&attr, type);
+    psa_set_key_bits(&attr, bits);
+    psa_set_key_usage_flags(&attr, usage);
+    psa_set_key_algorithm(&attr, alg);
+
+    return driver_dispatch(&iov, &attr, CRYPTO_BENCHMARK_DRIVER_ATTR_SIZE,
+                           data, data_len, p_key, sizeof(*p_key));
+}
+
+/**
+ * \brief Generate a key through the dispatcher, for the calling partition
+ */
+static psa_status_t driver_generate_key(psa_key_type_t type, size_t bits,
+                                        psa_key_usage_t usage,
+                                        psa_algorithm_t alg,
+                                        psa_key_id_t *p_key)
+{
+    psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_GENERATE_KEY_SID,
+    };
+
+    psa_set_key_type(&attr, type);
+    psa_set_key_bits(&attr, bits);
+    psa_set_key_usage_flags(&attr, usage);
+    psa_set_key_algorithm(&attr, alg);
+
+    return driver_dispatch(&iov, &attr, CRYPTO_BENCHMARK_DRIVER_ATTR_SIZE,
+                           NULL, 0, p_key, sizeof(*p_key));
+}
+
+static void driver_destroy_key(psa_key_id_t key)
+{
+    struct tfm_crypto_pack_iovec iov = {
+        .function_id = TFM_CRYPTO_DESTROY_KEY_SID,
+        .key_id = key,
+    };
+
+    (void)driver_dispatch(&iov, NULL, 0, NULL, 0, NULL, 0);
+}
+
+/**
+ * \brief Sweep a group whose payload is the input, or the output when the
+ *        request has no input payload. The output buffer always leaves room
+ *        for an IV, a tag or a digest.
+ */
+static void driver_sweep(const char *name,
+                         const struct tfm_crypto_pack_iovec *iov,
+                         bool has_input)
+{
+    size_t size;
+
+    for (size = CRYPTO_BENCHMARK_DRIVER_FIRST_SIZE;
+         size <= CRYPTO_BENCHMARK_DRIVER_MAX_SIZE; size <<= 2) {
+        if (has_input) {
+            driver_run_point(name, iov, driver_in, size,
+                             driver_out, size + CRYPTO_BENCHMARK_DRIVER_OUT_EXTRA,
+                             size);
+        } else {
+            driver_run_point(name, iov, NULL, 0, driver_out, size, size);
+        }
+    }
+}
+
+static void driver_run_key_management(void)
+{
+    psa_key_id_t key = 0;
+    uint32_t total = 0;
+    uint32_t i;
+
+    for (i = 0; i < CRYPTO_BENCHMARK_DRIVER_ITERATIONS; i++) {
+        if (driver_import_key(PSA_KEY_TYPE_AES, 128, PSA_KEY_USAGE_ENCRYPT,
+                              PSA_ALG_CTR, driver_in, 16, &key) != PSA_SUCCESS) {
+            LOG_INFFMT("[INF][Crypto] KEY: import not supported\r\n");
+            return;
+        }
+        total += driver_cycles;
+        driver_destroy_key(key);
+        total += driver_cycles;
+    }
+
+    LOG_INFFMT("[INF][Crypto] KEY AES-128 import+destroy: %u cyc/call\r\n",
+               total / CRYPTO_BENCHMARK_DRIVER_ITERATIONS);
+}
+
+static void driver_run_symmetric(void)
+{
+    struct tfm_crypto_pack_iovec iov = {0};
+    psa_key_id_t key = 0;
+
+    iov.function_id = TFM_CRYPTO_HASH_COMPUTE_SID;
+    iov.alg = PSA_ALG_SHA_256;
+    driver_sweep("HASH SHA-256", &iov, true);
+
+    if (driver_import_key(PSA_KEY_TYPE_HMAC, 256, PSA_KEY_USAGE_SIGN_MESSAGE,
+                          PSA_ALG_HMAC(PSA_ALG_SHA_256), driver_in, 32,
+                          &key) == PSA_SUCCESS) {
+        iov.function_id = TFM_CRYPTO_MAC_COMPUTE_SID;
+        iov.key_id = key;
+        iov.alg = PSA_ALG_HMAC(PSA_ALG_SHA_256);
+        driver_sweep("MAC HMAC-SHA-256", &iov, true);
+        driver_destroy_key(key);
+    }
+
+    if (driver_import_key(PSA_KEY_TYPE_AES, 128, PSA_KEY_USAGE_ENCRYPT,
+                          PSA_ALG_CTR, driver_in, 16, &key) == PSA_SUCCESS) {
+        iov.function_id = TFM_CRYPTO_CIPHER_ENCRYPT_SID;
+        iov.key_id = key;
+        iov.alg = PSA_ALG_CTR;
+        driver_sweep("CIPHER AES-128-CTR", &iov, true);
+        driver_destroy_key(key);
+    }
+
+    if (driver_import_key(PSA_KEY_TYPE_AES, 128, PSA_KEY_USAGE_ENCRYPT,
+                          PSA_ALG_GCM, driver_in, 16, &key) == PSA_SUCCESS) {
+        (void)memset(&iov, 0, sizeof(iov));
+        iov.function_id = TFM_CRYPTO_AEAD_ENCRYPT_SID;
+        iov.key_id = key;
+        iov.alg = PSA_ALG_GCM;
+        iov.aead_in.nonce_length = 12;
+        driver_sweep("AEAD AES-128-GCM", &iov, true);
+        driver_destroy_key(key);
+    }
+}
+
+static void driver_run_asymmetric(void)
+{
+    struct tfm_crypto_pack_iovec iov = {0};
+    psa_key_id_t key = 0;
+
+    if (driver_generate_key(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+                            256, PSA_KEY_USAGE_SIGN_HASH,
+                            PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+                            &key) != PSA_SUCCESS) {
+        LOG_INFFMT("[INF][Crypto] SIGN: no ECC P-256 key\r\n");
+        return;
+    }
+
+    iov.function_id = TFM_CRYPTO_ASYMMETRIC_SIGN_HASH_SID;
+    iov.key_id = key;
+    iov.alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+    driver_run_point("SIGN ECDSA-P256", &iov, driver_in, 32,
+                     driver_out, CRYPTO_BENCHMARK_DRIVER_OUT_EXTRA, 32);
+
+    driver_destroy_key(key);
+}
+
+static void driver_run_key_derivation(void)
+{
+    static const uint8_t info[] = "benchmark";
+    struct tfm_crypto_pack_iovec iov = {0};
+    uint32_t handle = 0;
+    size_t size;
+
+    for (size = CRYPTO_BENCHMARK_DRIVER_FIRST_SIZE;
+         size <= CRYPTO_BENCHMARK_DRIVER_MAX_SIZE; size <<= 2) {
+        /* HKDF-SHA-256 outputs at most 255 blocks */
+        if (size > (255u * 32u)) {
+            break;
+        }
+
+        (void)memset(&iov, 0, sizeof(iov));
+        iov.function_id = TFM_CRYPTO_KEY_DERIVATION_SETUP_SID;
+        iov.alg = PSA_ALG_HKDF(PSA_ALG_SHA_256);
+        if (driver_dispatch(&iov, NULL, 0, NULL, 0,
+                            &handle, sizeof(handle)) != PSA_SUCCESS) {
+            LOG_INFFMT("[INF][Crypto] DERIVE: HKDF not supported\r\n");
+            return;
+        }
+
+        iov.op_handle = handle;
+        iov.function_id = TFM_CRYPTO_KEY_DERIVATION_INPUT_BYTES_SID;
+        iov.step = PSA_KEY_DERIVATION_INPUT_SECRET;
+        (void)driver_dispatch(&iov, driver_in, 32, NULL, 0, NULL, 0);
+        iov.step = PSA_KEY_DERIVATION_INPUT_INFO;
+        (void)driver_dispatch(&iov, info, sizeof(info) - 1, NULL, 0, NULL, 0);
+
+        /* Each iteration consumes capacity, one output per operation */
+        iov.function_id = TFM_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES_SID;
+        if (driver_dispatch(&iov, NULL, 0, NULL, 0,
+                            driver_out, size) == PSA_SUCCESS) {
+            driver_print_point("DERIVE HKDF-SHA-256", size, driver_cycles,
+                               driver_cycles - primitive_cycles);
+        }
+
+        iov.function_id = TFM_CRYPTO_KEY_DERIVATION_ABORT_SID;
+        (void)driver_dispatch(&iov, NULL, 0, NULL, 0, &handle, sizeof(handle));
+    }
+}
+
+void tfm_crypto_benchmark_run(void)
+{
+    struct tfm_crypto_pack_iovec iov = {0};
+
+    LOG_INFFMT("[INF][Crypto] Benchmark driver @ %u Hz, %u requests per point\r\n",
+               SystemCoreClock, CRYPTO_BENCHMARK_DRIVER_ITERATIONS);
+
+    (void)memset(driver_in, 0xA5, sizeof(driver_in));
+
+    iov.function_id = TFM_CRYPTO_GENERATE_RANDOM_SID;
+    driver_sweep("RNG", &iov, false);
+
+    driver_run_key_management();
+    driver_run_symmetric();
+    driver_run_asymmetric();
+    driver_run_key_derivation();
+
+    LOG_INFFMT("[INF][Crypto] ENCRYPT: not driven, no RSA key is generated\r\n");
+}
+#endif /* CRYPTO_BENCHMARK_DRIVER */
+
+#endif /* CRYPTO_BENCHMARK_ENABLED */
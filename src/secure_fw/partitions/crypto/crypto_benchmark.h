@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __CRYPTO_BENCHMARK_H__
+#define __CRYPTO_BENCHMARK_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Number of payload size classes tracked per dispatcher group. Class
+ *        \a n collects requests with a payload smaller than 16 * 4^n bytes,
+ *        the last class collects everything above.
+ */
+#define CRYPTO_BENCHMARK_SIZE_CLASSES (6u)
+
+/**
+ * \brief Initialise the benchmark module and start the cycle counter
+ */
+void tfm_crypto_benchmark_init(void);
+
+/**
+ * \brief Mark the start of a request, i.e. the point at which the service
+ *        receives the message, before any IOVEC is read or mapped
+ */
+void tfm_crypto_benchmark_request_begin(void);
+
+/**
+ * \brief Mark the start of the primitive, i.e. the point at which the
+ *        dispatcher hands over to the group specific interface
+ */
+void tfm_crypto_benchmark_primitive_begin(void);
+
+/**
+ * \brief Mark the end of the primitive
+ */
+void tfm_crypto_benchmark_primitive_end(void);
+
+/**
+ * \brief Mark the end of a request and account it to its group and payload
+ *        size class. Periodically dumps the collected statistics.
+ *
+ * \param[in] function_id  Function ID of the request, \ref tfm_crypto_func_sid_t
+ * \param[in] in_vec       Array of invec parameters
+ * \param[in] in_len       Length of the valid entries in in_vec
+ * \param[in] out_vec      Array of outvec parameters
+ * \param[in] out_len      Length of the valid entries in out_vec
+ */
+void tfm_crypto_benchmark_request_end(uint16_t function_id,
+                                      const psa_invec in_vec[],
+                                      size_t in_len,
+                                      const psa_outvec out_vec[],
+                                      size_t out_len);
+
+/**
+ * \brief Print the statistics collected so far and reset them
+ */
+void tfm_crypto_benchmark_dump(void);
+
+/**
+ * \brief Drive each dispatcher group over a sweep of payload sizes, up to
+ *        CRYPTO_BENCHMARK_DRIVER_MAX_SIZE, and print the cycles per call and
+ *        the MB/s reached. The caller ID must be set to the Crypto partition.
+ */
+void tfm_crypto_benchmark_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CRYPTO_BENCHMARK_H__ */
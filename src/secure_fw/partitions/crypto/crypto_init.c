@@ -21,6 +21,14 @@
 
 #include "crypto_library.h"
 
+#if CRYPTO_BENCHMARK_ENABLED
+#include "crypto_benchmark.h"
+#endif /* CRYPTO_BENCHMARK_ENABLED */
+
+#if CRYPTO_BENCHMARK_DRIVER
+#include "psa_manifest/pid.h"
+#endif /* CRYPTO_BENCHMARK_DRIVER */
+
 #if CRYPTO_NV_SEED
 #include "tfm_plat_crypto_nv_seed.h"
 #endif /* CRYPTO_NV_SEED */
@@ -32,7 +40,11 @@
 #include <string.h>
 #include "psa/framework_feature.h"
 #include "psa/service.h"
+#ifdef TFM_PARTITION_CRYPTO_IPC
+#include "psa_manifest/tfm_crypto_ipc.h"
+#else
 #include "psa_manifest/tfm_crypto.h"
+#endif /* TFM_PARTITION_CRYPTO_IPC */
 
 /**
  * \brief Aligns a value x up to an alignment a.
@@ -194,7 +206,7 @@ static psa_status_t tfm_crypto_init_iovecs(const psa_msg_t *msg,
 }
 #endif /* PSA_FRAMEWORK_HAS_MM_IOVEC == 1 */
 
-static psa_status_t tfm_crypto_call_srv(const psa_msg_t *msg)
+static psa_status_t tfm_crypto_call_srv(const psa_msg_t *msg, bool fast_path)
 {
     psa_status_t status = PSA_SUCCESS;
     size_t in_len = PSA_MAX_IOVEC, out_len = PSA_MAX_IOVEC, i;
@@ -202,6 +214,10 @@ static psa_status_t tfm_crypto_call_srv(const psa_msg_t *msg)
     psa_outvec out_vec[PSA_MAX_IOVEC] = { {NULL, 0} };
     struct tfm_crypto_pack_iovec iov = {0};
 
+#if CRYPTO_BENCHMARK_ENABLED
+    tfm_crypto_benchmark_request_begin();
+#endif
+
     /* Check the number of in_vec filled */
     while ((in_len > 0) && (msg->in_size[in_len - 1] == 0)) {
         in_len--;
@@ -221,6 +237,12 @@ static psa_status_t tfm_crypto_call_srv(const psa_msg_t *msg)
         return PSA_ERROR_GENERIC_ERROR;
     }
 
+    /* Long-running requests must not delay the fast path service */
+    if (fast_path &&
+        !TFM_CRYPTO_IS_FAST_PATH_GROUP(TFM_CRYPTO_GET_GROUP_ID(iov.function_id))) {
+        return PSA_ERROR_NOT_PERMITTED;
+    }
+
     /* Initialise the first iovec with the IOV read when parsing */
     in_vec[0].base = &iov;
     in_vec[0].len = sizeof(struct tfm_crypto_pack_iovec);
@@ -253,6 +275,11 @@ static psa_status_t tfm_crypto_call_srv(const psa_msg_t *msg)
     tfm_crypto_clear_scratch();
 #endif
 
+#if CRYPTO_BENCHMARK_ENABLED
+    tfm_crypto_benchmark_request_end(iov.function_id, in_vec, in_len,
+                                     out_vec, out_len);
+#endif
+
     return status;
 }
 
@@ -304,6 +331,10 @@ static psa_status_t tfm_crypto_engine_init(void)
 
 static psa_status_t tfm_crypto_module_init(void)
 {
+#if CRYPTO_BENCHMARK_ENABLED
+    tfm_crypto_benchmark_init();
+#endif
+
     /* Init the Alloc module */
     return tfm_crypto_init_alloc();
 }
@@ -324,19 +355,97 @@ psa_status_t tfm_crypto_init(void)
         return status;
     }
 
+#if CRYPTO_ALT_KERNELS_SELF_TEST
+    /* Do not serve requests with a broken kernel */
+    status = tfm_crypto_alt_kernels_self_test();
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+#endif
+
+#if CRYPTO_BENCHMARK_DRIVER
+    /* Sweep the groups before serving requests, the keys belong to Crypto */
+    tfm_crypto_set_caller_id(TFM_SP_CRYPTO);
+    tfm_crypto_benchmark_run();
+    tfm_crypto_set_caller_id(0);
+#endif
+
     return PSA_SUCCESS;
 }
 
+#ifdef TFM_PARTITION_CRYPTO_IPC
+static void tfm_crypto_handle_signal(psa_signal_t signal, bool fast_path)
+{
+    psa_msg_t msg;
+    psa_status_t status;
+
+    if (psa_get(signal, &msg) != PSA_SUCCESS) {
+        return;
+    }
+
+    /* Process the message type */
+    switch (msg.type) {
+    case PSA_IPC_CALL:
+        status = tfm_crypto_call_srv(&msg, fast_path);
+        break;
+    default:
+        status = PSA_ERROR_NOT_SUPPORTED;
+        break;
+    }
+
+    psa_reply(msg.handle, status);
+}
+
+void tfm_crypto_entry(void)
+{
+    psa_signal_t signals;
+
+    if (tfm_crypto_init() != PSA_SUCCESS) {
+        psa_panic();
+    }
+
+    while (1) {
+#if CRYPTO_RNG_MODULE_ENABLED && (CRYPTO_RNG_RESERVOIR_SIZE > 0)
+        /* Use idle time to top up the random bytes reservoir, so that the
+         * next small random request does not need to run the DRBG.
+         */
+        signals = psa_wait(TFM_CRYPTO_SIGNAL | TFM_CRYPTO_FAST_SIGNAL,
+                           PSA_POLL);
+        if (signals == 0) {
+            (void)tfm_crypto_random_reservoir_refill();
+            signals = psa_wait(TFM_CRYPTO_SIGNAL | TFM_CRYPTO_FAST_SIGNAL,
+                               PSA_BLOCK);
+        }
+#else
+        signals = psa_wait(TFM_CRYPTO_SIGNAL | TFM_CRYPTO_FAST_SIGNAL,
+                           PSA_BLOCK);
+#endif
+
+        /* The fast path signal stays asserted while messages are pending on
+         * it, so drain them all before taking the next slow path message.
+         * A fast path request waits for at most one slow path operation.
+         */
+        if (signals & TFM_CRYPTO_FAST_SIGNAL) {
+            tfm_crypto_handle_signal(TFM_CRYPTO_FAST_SIGNAL, true);
+        } else if (signals & TFM_CRYPTO_SIGNAL) {
+            tfm_crypto_handle_signal(TFM_CRYPTO_SIGNAL, false);
+        } else {
+            psa_panic();
+        }
+    }
+}
+#else
 psa_status_t tfm_crypto_sfn(const psa_msg_t *msg)
 {
     /* Process the message type */
     switch (msg->type) {
     case PSA_IPC_CALL:
-        return tfm_crypto_call_srv(msg);
+        return tfm_crypto_call_srv(msg, false);
     default:
         return PSA_ERROR_NOT_SUPPORTED;
     }
 }
+#endif /* TFM_PARTITION_CRYPTO_IPC */
 
 psa_status_t tfm_crypto_api_dispatcher(psa_invec in_vec[],
                                        size_t in_len,
@@ -372,31 +481,49 @@ psa_status_t tfm_crypto_api_dispatcher(psa_invec in_vec[],
     }
 
     /* Dispatch to each sub-module based on the Group ID */
+#if CRYPTO_BENCHMARK_ENABLED
+    tfm_crypto_benchmark_primitive_begin();
+#endif
     switch (group_id) {
     case TFM_CRYPTO_GROUP_ID_KEY_MANAGEMENT:
-        return tfm_crypto_key_management_interface(in_vec, out_vec,
-                                                   &encoded_key);
+        status = tfm_crypto_key_management_interface(in_vec, out_vec,
+                                                     &encoded_key);
+        break;
     case TFM_CRYPTO_GROUP_ID_HASH:
-        return tfm_crypto_hash_interface(in_vec, out_vec);
+        status = tfm_crypto_hash_interface(in_vec, out_vec);
+        break;
     case TFM_CRYPTO_GROUP_ID_MAC:
-        return tfm_crypto_mac_interface(in_vec, out_vec, &encoded_key);
+        status = tfm_crypto_mac_interface(in_vec, out_vec, &encoded_key);
+        break;
     case TFM_CRYPTO_GROUP_ID_CIPHER:
-        return tfm_crypto_cipher_interface(in_vec, out_vec, &encoded_key);
+        status = tfm_crypto_cipher_interface(in_vec, out_vec, &encoded_key);
+        break;
     case TFM_CRYPTO_GROUP_ID_AEAD:
-        return tfm_crypto_aead_interface(in_vec, out_vec, &encoded_key);
+        status = tfm_crypto_aead_interface(in_vec, out_vec, &encoded_key);
+        break;
     case TFM_CRYPTO_GROUP_ID_ASYM_SIGN:
-        return tfm_crypto_asymmetric_sign_interface(in_vec, out_vec,
-                                                    &encoded_key);
+        status = tfm_crypto_asymmetric_sign_interface(in_vec, out_vec,
+                                                      &encoded_key);
+        break;
     case TFM_CRYPTO_GROUP_ID_ASYM_ENCRYPT:
-        return tfm_crypto_asymmetric_encrypt_interface(in_vec, out_vec,
-                                                       &encoded_key);
+        status = tfm_crypto_asymmetric_encrypt_interface(in_vec, out_vec,
+                                                         &encoded_key);
+        break;
     case TFM_CRYPTO_GROUP_ID_KEY_DERIVATION:
-        return tfm_crypto_key_derivation_interface(in_vec, out_vec,
-                                                   &encoded_key);
+        status = tfm_crypto_key_derivation_interface(in_vec, out_vec,
+                                                     &encoded_key);
+        break;
     case TFM_CRYPTO_GROUP_ID_RANDOM:
-        return tfm_crypto_random_interface(in_vec, out_vec);
+        status = tfm_crypto_random_interface(in_vec, out_vec);
+        break;
     default:
         LOG_ERRFMT("[ERR][Crypto] Unsupported request!\r\n");
-        return PSA_ERROR_NOT_SUPPORTED;
+        status = PSA_ERROR_NOT_SUPPORTED;
+        break;
     }
+#if CRYPTO_BENCHMARK_ENABLED
+    tfm_crypto_benchmark_primitive_end();
+#endif
+
+    return status;
 }
@@ -1,6 +1,8 @@
 /*
  * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
  * Copyright (c) 2021, Nordic Semiconductor ASA.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -8,6 +10,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "config_tfm.h"
 #include "tfm_mbedcrypto_include.h"
@@ -21,6 +24,71 @@
  */
 
 /*!@{*/
+#if CRYPTO_RNG_MODULE_ENABLED && (CRYPTO_RNG_RESERVOIR_SIZE > 0)
+#if CRYPTO_RNG_RESERVOIR_MAX_REQUEST > CRYPTO_RNG_RESERVOIR_SIZE
+#error "CRYPTO_RNG_RESERVOIR_MAX_REQUEST must not exceed CRYPTO_RNG_RESERVOIR_SIZE"
+#endif
+
+/*
+ * Random bytes generated ahead of time in large blocks. The valid bytes are
+ * always reservoir[0..reservoir_available), requests are served from the top
+ * and refills append after the remaining bytes.
+ */
+static uint8_t reservoir[CRYPTO_RNG_RESERVOIR_SIZE];
+static size_t reservoir_available;
+
+psa_status_t tfm_crypto_random_reservoir_refill(void)
+{
+    psa_status_t status;
+
+    if (reservoir_available == CRYPTO_RNG_RESERVOIR_SIZE) {
+        return PSA_SUCCESS;
+    }
+
+    status = psa_generate_random(&reservoir[reservoir_available],
+                                 CRYPTO_RNG_RESERVOIR_SIZE - reservoir_available);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+    reservoir_available = CRYPTO_RNG_RESERVOIR_SIZE;
+
+    return PSA_SUCCESS;
+}
+
+static psa_status_t tfm_crypto_random_reservoir_get(uint8_t *output,
+                                                    size_t output_size)
+{
+    psa_status_t status;
+
+    /* Even a full reservoir cannot serve it */
+    if (output_size > CRYPTO_RNG_RESERVOIR_SIZE) {
+        return psa_generate_random(output, output_size);
+    }
+
+    if (output_size > reservoir_available) {
+        status = tfm_crypto_random_reservoir_refill();
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+    }
+
+    reservoir_available -= output_size;
+    (void)memcpy(output, &reservoir[reservoir_available], output_size);
+
+#if CRYPTO_RNG_RESERVOIR_BACKTRACKING_RESISTANCE
+    /* Bytes handed out must not be recoverable from the partition memory */
+    (void)memset(&reservoir[reservoir_available], 0, output_size);
+#endif
+
+    return PSA_SUCCESS;
+}
+#else
+psa_status_t tfm_crypto_random_reservoir_refill(void)
+{
+    return PSA_SUCCESS;
+}
+#endif /* CRYPTO_RNG_MODULE_ENABLED && (CRYPTO_RNG_RESERVOIR_SIZE > 0) */
+
 psa_status_t tfm_crypto_random_interface(psa_invec in_vec[],
                                          psa_outvec out_vec[])
 {
@@ -33,6 +101,15 @@ psa_status_t tfm_crypto_random_interface(psa_invec in_vec[],
     uint8_t *output = out_vec[0].base;
     size_t output_size = out_vec[0].len;
 
+    (void)in_vec;
+
+#if CRYPTO_RNG_RESERVOIR_SIZE > 0
+    /* Small requests, i.e. nonces and IVs, are served from RAM */
+    if (output_size <= CRYPTO_RNG_RESERVOIR_MAX_REQUEST) {
+        return tfm_crypto_random_reservoir_get(output, output_size);
+    }
+#endif
+
     return psa_generate_random(output, output_size);
 #endif
 }
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2019-2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -156,6 +158,26 @@
         PSA_FUNCTION_NAME(psa_sign_hash)
 #define psa_verify_hash \
         PSA_FUNCTION_NAME(psa_verify_hash)
+#define psa_interruptible_set_max_ops \
+        PSA_FUNCTION_NAME(psa_interruptible_set_max_ops)
+#define psa_interruptible_get_max_ops \
+        PSA_FUNCTION_NAME(psa_interruptible_get_max_ops)
+#define psa_sign_hash_get_num_ops \
+        PSA_FUNCTION_NAME(psa_sign_hash_get_num_ops)
+#define psa_verify_hash_get_num_ops \
+        PSA_FUNCTION_NAME(psa_verify_hash_get_num_ops)
+#define psa_sign_hash_start \
+        PSA_FUNCTION_NAME(psa_sign_hash_start)
+#define psa_sign_hash_complete \
+        PSA_FUNCTION_NAME(psa_sign_hash_complete)
+#define psa_sign_hash_abort \
+        PSA_FUNCTION_NAME(psa_sign_hash_abort)
+#define psa_verify_hash_start \
+        PSA_FUNCTION_NAME(psa_verify_hash_start)
+#define psa_verify_hash_complete \
+        PSA_FUNCTION_NAME(psa_verify_hash_complete)
+#define psa_verify_hash_abort \
+        PSA_FUNCTION_NAME(psa_verify_hash_abort)
 #define psa_asymmetric_encrypt \
         PSA_FUNCTION_NAME(psa_asymmetric_encrypt)
 #define psa_asymmetric_decrypt \
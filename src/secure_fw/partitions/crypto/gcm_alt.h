@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/**
+ * \file Context of the GCM implementation of tfm_mbedcrypto_alt.c, included by
+ *       mbedtls/gcm.h when MBEDTLS_GCM_ALT is selected.
+ */
+
+#ifndef __GCM_ALT_H__
+#define __GCM_ALT_H__
+
+#include <stdint.h>
+#include "mbedtls/private_access.h"
+#include "mbedtls/cipher.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief The GCM context structure
+ */
+typedef struct mbedtls_gcm_context {
+    mbedtls_cipher_context_t MBEDTLS_PRIVATE(cipher_ctx); /*!< The block cipher in ECB mode */
+    uint64_t MBEDTLS_PRIVATE(h)[2];              /*!< The hash subkey H, big-endian */
+    uint64_t MBEDTLS_PRIVATE(len);               /*!< Bytes of data processed */
+    uint64_t MBEDTLS_PRIVATE(add_len);           /*!< Bytes of additional data */
+    unsigned char MBEDTLS_PRIVATE(base_ectr)[16]; /*!< E(K, Y0), masks the tag */
+    unsigned char MBEDTLS_PRIVATE(y)[16];        /*!< Counter block of the last keystream */
+    unsigned char MBEDTLS_PRIVATE(ectr)[16];     /*!< Keystream of the last data block */
+    unsigned char MBEDTLS_PRIVATE(buf)[16];      /*!< GHASH accumulator */
+    int MBEDTLS_PRIVATE(mode);                   /*!< MBEDTLS_GCM_ENCRYPT or MBEDTLS_GCM_DECRYPT */
+} mbedtls_gcm_context;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GCM_ALT_H__ */
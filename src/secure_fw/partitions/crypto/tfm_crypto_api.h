@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -31,6 +33,8 @@ enum tfm_crypto_operation_type {
     TFM_CRYPTO_HASH_OPERATION = 3,
     TFM_CRYPTO_KEY_DERIVATION_OPERATION = 4,
     TFM_CRYPTO_AEAD_OPERATION = 5,
+    TFM_CRYPTO_SIGN_HASH_OPERATION = 6,
+    TFM_CRYPTO_VERIFY_HASH_OPERATION = 7,
 
     /* Used to force the enum size */
     TFM_CRYPTO_OPERATION_TYPE_MAX = INT_MAX
@@ -43,6 +47,16 @@ enum tfm_crypto_operation_type {
  */
 psa_status_t tfm_crypto_init(void);
 
+/**
+ * \brief Check the AES and SHA-256 kernels in use against known-answer
+ *        vectors, and log their cycles per block with
+ *        CRYPTO_BENCHMARK_ENABLED. Only built with
+ *        CRYPTO_ALT_KERNELS_SELF_TEST.
+ *
+ * \return Return values as described in \ref psa_status_t
+ */
+psa_status_t tfm_crypto_alt_kernels_self_test(void);
+
 /**
  * \brief Initialise the Alloc module
  *
@@ -206,6 +220,14 @@ psa_status_t tfm_crypto_key_derivation_interface(psa_invec in_vec[],
  */
 psa_status_t tfm_crypto_random_interface(psa_invec in_vec[],
                                          psa_outvec out_vec[]);
+/**
+ * \brief Top up the reservoir of random bytes used to serve small requests
+ *        of the Random module. Does nothing if the reservoir is disabled or
+ *        already full.
+ *
+ * \return Return values as described in \ref psa_status_t
+ */
+psa_status_t tfm_crypto_random_reservoir_refill(void);
 /**
  * \brief This function acts as interface for the Hash module
  *
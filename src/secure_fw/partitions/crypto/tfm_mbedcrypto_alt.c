@@ -1,7 +1,11 @@
 /*
  * Copyright (c) 2020, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ * Copyright (c) 2016 Thomas Pornin <pornin@bolet.org>, for the parts derived
+ * from BearSSL, see the notice of the constant-time AES kernel below.
  *
- * SPDX-License-Identifier: BSD-3-Clause
+ * SPDX-License-Identifier: BSD-3-Clause AND MIT
  *
  */
 
@@ -16,15 +20,31 @@
  *       of mbed TLS.
  */
 
+/* The alternative kernels below need to access the mbed TLS contexts */
+#define MBEDTLS_ALLOW_PRIVATE_ACCESS
+
 /*
  * A dummy include. Just add a dependency to make sure this file is compiled
  * after all crypto header files are installed and configuration flags are set.
  */
 #include "tfm_mbedcrypto_include.h"
-#if defined(MBEDTLS_AES_DECRYPT_ALT) || defined(MBEDTLS_AES_SETKEY_DEC_ALT)
+#if defined(MBEDTLS_AES_DECRYPT_ALT) || defined(MBEDTLS_AES_SETKEY_DEC_ALT) || \
+    defined(MBEDTLS_AES_ENCRYPT_ALT) || defined(MBEDTLS_AES_SETKEY_ENC_ALT)
 #include "mbedtls/aes.h"
 #include "mbedtls/error.h"
 #endif
+#if defined(MBEDTLS_AES_ENCRYPT_ALT) || defined(MBEDTLS_SHA256_PROCESS_ALT) || \
+    defined(MBEDTLS_GCM_ALT)
+#include <stdint.h>
+#include <string.h>
+#include "mbedtls/platform_util.h"
+#endif
+#if defined(MBEDTLS_SHA256_PROCESS_ALT)
+#include "mbedtls/sha256.h"
+#endif
+#if defined(MBEDTLS_GCM_ALT)
+#include "mbedtls/gcm.h"
+#endif
 
 #if defined(MBEDTLS_AES_DECRYPT_ALT) && defined(MBEDTLS_CCM_C)
 #pragma message("mbedtls_internal_aes_decrypt() is replaced by an empty wrapper to decrease memory footprint")
@@ -62,3 +82,1068 @@ int mbedtls_aes_setkey_dec(mbedtls_aes_context *ctx, const unsigned char *key,
     return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
 }
 #endif
+
+#if defined(MBEDTLS_AES_SETKEY_ENC_ALT) != defined(MBEDTLS_AES_ENCRYPT_ALT)
+#error "MBEDTLS_AES_SETKEY_ENC_ALT and MBEDTLS_AES_ENCRYPT_ALT must be selected together"
+#endif
+
+#if defined(MBEDTLS_AES_ENCRYPT_ALT)
+#pragma message("mbedtls_internal_aes_encrypt() is replaced by a constant-time bitsliced implementation")
+/*
+ * Constant-time AES encryption for targets without a crypto accelerator. The
+ * S-box is computed with the Boyar-Peralta circuit on a bitsliced state, so
+ * there are no table lookups and no memory accesses that depend on the key or
+ * on the data.
+ *
+ * The round keys are stored in ctx->buf in the standard format, so that the
+ * portable mbedtls_aes_setkey_dec() and mbedtls_internal_aes_decrypt() keep
+ * working on top of this key schedule. They are converted to the bitsliced
+ * form on the stack for each call.
+ *
+ * The bitsliced state holds two blocks. mbed TLS requests one block at a
+ * time, so the second lane encrypts the input incremented as a 128-bit
+ * big-endian counter, which is the next block requested by CTR, GCM (unless
+ * its 32-bit counter wraps) and CTR_DRBG, and the result is kept for the next
+ * call on the same context.
+ * Whether a call is served from that block depends only on the sequence of
+ * inputs, never on the key.
+ *
+ * The bitsliced representation, aes_ct_ortho(), aes_ct_sbox() and the
+ * ShiftRows/MixColumns masks are derived from the aes_ct implementation of
+ * BearSSL, which is distributed under the following terms:
+ *
+ * Copyright (c) 2016 Thomas Pornin <pornin@bolet.org>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define AES_CT_SWAPN(cl, ch, s, x, y)                           \
+    do {                                                        \
+        uint32_t a = (x);                                       \
+        uint32_t b = (y);                                       \
+        (x) = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+        (y) = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+    } while (0)
+
+/* Convert between 8 words of state and the bitsliced representation */
+static void aes_ct_ortho(uint32_t q[8])
+{
+    AES_CT_SWAPN(0x55555555, 0xAAAAAAAA, 1, q[0], q[1]);
+    AES_CT_SWAPN(0x55555555, 0xAAAAAAAA, 1, q[2], q[3]);
+    AES_CT_SWAPN(0x55555555, 0xAAAAAAAA, 1, q[4], q[5]);
+    AES_CT_SWAPN(0x55555555, 0xAAAAAAAA, 1, q[6], q[7]);
+
+    AES_CT_SWAPN(0x33333333, 0xCCCCCCCC, 2, q[0], q[2]);
+    AES_CT_SWAPN(0x33333333, 0xCCCCCCCC, 2, q[1], q[3]);
+    AES_CT_SWAPN(0x33333333, 0xCCCCCCCC, 2, q[4], q[6]);
+    AES_CT_SWAPN(0x33333333, 0xCCCCCCCC, 2, q[5], q[7]);
+
+    AES_CT_SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, q[0], q[4]);
+    AES_CT_SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, q[1], q[5]);
+    AES_CT_SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, q[2], q[6]);
+    AES_CT_SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, q[3], q[7]);
+}
+
+/*
+ * Bitsliced AES S-box, from the circuit of Boyar and Peralta, "A new
+ * combinational logic minimization technique with applications to
+ * cryptology". Input bits x0..x7 and output bits s0..s7 are numbered from
+ * the most significant one.
+ */
+static void aes_ct_sbox(uint32_t q[8])
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11;
+    uint32_t y12, y13, y14, y15, y16, y17, y18, y19, y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8;
+    uint32_t z9, z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* Top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* Non-linear section */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* Bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+static uint32_t aes_ct_sub_word(uint32_t x)
+{
+    uint32_t q[8];
+    unsigned int i;
+
+    for (i = 0; i < 8; i++) {
+        q[i] = x;
+    }
+    aes_ct_ortho(q);
+    aes_ct_sbox(q);
+    aes_ct_ortho(q);
+
+    return q[0];
+}
+
+static inline uint32_t aes_ct_get_le32(const unsigned char *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void aes_ct_put_le32(unsigned char *p, uint32_t x)
+{
+    p[0] = (unsigned char)x;
+    p[1] = (unsigned char)(x >> 8);
+    p[2] = (unsigned char)(x >> 16);
+    p[3] = (unsigned char)(x >> 24);
+}
+
+/*
+ * Block computed by the second lane for the context that requested the last
+ * block. The Crypto partition serves one request at a time.
+ */
+static struct {
+    const mbedtls_aes_context *ctx;
+    uint32_t input[4];
+    uint32_t output[4];
+} aes_ct_next;
+
+int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key,
+                           unsigned int keybits)
+{
+    static const unsigned char rcon[] = {
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+    };
+    uint32_t *rk = ctx->buf;
+    unsigned int i, j, k, nk, nkf, nr;
+    uint32_t tmp = 0;
+
+    switch (keybits) {
+    case 128:
+        nr = 10;
+        break;
+#if !defined(MBEDTLS_AES_ONLY_128_BIT_KEY_LENGTH)
+    case 192:
+        nr = 12;
+        break;
+    case 256:
+        nr = 14;
+        break;
+#endif
+    default:
+        return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+    }
+
+    nk = keybits >> 5;
+    nkf = (nr + 1) << 2;
+    if (nkf > (sizeof(ctx->buf) / sizeof(ctx->buf[0]))) {
+        return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+    }
+
+    /* A block computed with the previous key must not be served */
+    mbedtls_platform_zeroize(&aes_ct_next, sizeof(aes_ct_next));
+
+    /* Standard key expansion, in the format of the portable implementation */
+    for (i = 0; i < nk; i++) {
+        tmp = aes_ct_get_le32(key + (i << 2));
+        rk[i] = tmp;
+    }
+    for (i = nk, j = 0, k = 0; i < nkf; i++) {
+        if (j == 0) {
+            tmp = (tmp << 24) | (tmp >> 8);
+            tmp = aes_ct_sub_word(tmp) ^ rcon[k];
+        } else if ((nk > 6) && (j == 4)) {
+            tmp = aes_ct_sub_word(tmp);
+        }
+        tmp ^= rk[i - nk];
+        rk[i] = tmp;
+        if (++j == nk) {
+            j = 0;
+            k++;
+        }
+    }
+
+    ctx->nr = (int)nr;
+    ctx->rk_offset = 0;
+
+    return 0;
+}
+
+static inline void aes_ct_add_round_key(uint32_t q[8], const uint32_t sk[8])
+{
+    unsigned int i;
+
+    for (i = 0; i < 8; i++) {
+        q[i] ^= sk[i];
+    }
+}
+
+static inline void aes_ct_shift_rows(uint32_t q[8])
+{
+    unsigned int i;
+    uint32_t x;
+
+    for (i = 0; i < 8; i++) {
+        x = q[i];
+        q[i] = (x & 0x000000FF)
+               | ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6)
+               | ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4)
+               | ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
+    }
+}
+
+static inline uint32_t aes_ct_rotr16(uint32_t x)
+{
+    return (x << 16) | (x >> 16);
+}
+
+static inline void aes_ct_mix_columns(uint32_t q[8])
+{
+    uint32_t q0, q1, q2, q3, q4, q5, q6, q7;
+    uint32_t r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0];
+    q1 = q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = q[5];
+    q6 = q[6];
+    q7 = q[7];
+    r0 = (q0 >> 8) | (q0 << 24);
+    r1 = (q1 >> 8) | (q1 << 24);
+    r2 = (q2 >> 8) | (q2 << 24);
+    r3 = (q3 >> 8) | (q3 << 24);
+    r4 = (q4 >> 8) | (q4 << 24);
+    r5 = (q5 >> 8) | (q5 << 24);
+    r6 = (q6 >> 8) | (q6 << 24);
+    r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q7 ^ r7 ^ r0 ^ aes_ct_rotr16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ aes_ct_rotr16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ aes_ct_rotr16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ aes_ct_rotr16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ aes_ct_rotr16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ aes_ct_rotr16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ aes_ct_rotr16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ aes_ct_rotr16(q7 ^ r7);
+}
+
+/* Encrypt the two blocks held in q, with the round keys in bitsliced form */
+static void aes_ct_encrypt_lanes(const uint32_t *skey, unsigned int nr,
+                                 uint32_t q[8])
+{
+    unsigned int i;
+
+    aes_ct_ortho(q);
+
+    aes_ct_add_round_key(q, skey);
+    for (i = 1; i < nr; i++) {
+        aes_ct_sbox(q);
+        aes_ct_shift_rows(q);
+        aes_ct_mix_columns(q);
+        aes_ct_add_round_key(q, skey + (i << 3));
+    }
+    aes_ct_sbox(q);
+    aes_ct_shift_rows(q);
+    aes_ct_add_round_key(q, skey + (nr << 3));
+
+    aes_ct_ortho(q);
+}
+
+int mbedtls_internal_aes_encrypt(mbedtls_aes_context *ctx,
+                                 const unsigned char input[16],
+                                 unsigned char output[16])
+{
+    /* Round keys of AES-256 in bitsliced form */
+    uint32_t skey[120];
+    uint32_t q[8];
+    unsigned char next[16];
+    uint32_t diff = 0;
+    unsigned int i, j, carry, nr = (unsigned int)ctx->nr;
+    const uint32_t *rk = ctx->buf + ctx->rk_offset;
+
+    for (i = 0; i < 4; i++) {
+        q[i << 1] = aes_ct_get_le32(input + (i << 2));
+        diff |= q[i << 1] ^ aes_ct_next.input[i];
+    }
+
+    if ((aes_ct_next.ctx == ctx) && (diff == 0)) {
+        for (i = 0; i < 4; i++) {
+            aes_ct_put_le32(output + (i << 2), aes_ct_next.output[i]);
+        }
+        mbedtls_platform_zeroize(&aes_ct_next, sizeof(aes_ct_next));
+        return 0;
+    }
+
+    /* The second lane takes the input incremented as a big-endian counter */
+    (void)memcpy(next, input, sizeof(next));
+    for (i = 16, carry = 1; i > 0; i--) {
+        carry += next[i - 1];
+        next[i - 1] = (unsigned char)carry;
+        carry >>= 8;
+    }
+    for (i = 0; i < 4; i++) {
+        q[(i << 1) + 1] = aes_ct_get_le32(next + (i << 2));
+    }
+
+    /* Each round key word goes in both lanes */
+    for (i = 0; i < ((nr + 1) << 2); i += 4) {
+        for (j = 0; j < 4; j++) {
+            skey[(i + j) << 1] = rk[i + j];
+            skey[((i + j) << 1) + 1] = rk[i + j];
+        }
+        aes_ct_ortho(skey + (i << 1));
+    }
+
+    aes_ct_encrypt_lanes(skey, nr, q);
+
+    for (i = 0; i < 4; i++) {
+        aes_ct_put_le32(output + (i << 2), q[i << 1]);
+        aes_ct_next.input[i] = aes_ct_get_le32(next + (i << 2));
+        aes_ct_next.output[i] = q[(i << 1) + 1];
+    }
+    aes_ct_next.ctx = ctx;
+
+    mbedtls_platform_zeroize(skey, sizeof(skey));
+    mbedtls_platform_zeroize(q, sizeof(q));
+
+    return 0;
+}
+#endif /* MBEDTLS_AES_ENCRYPT_ALT */
+
+#if defined(MBEDTLS_GCM_ALT)
+#if !defined(MBEDTLS_CIPHER_C)
+#error "MBEDTLS_GCM_ALT requires MBEDTLS_CIPHER_C"
+#endif
+#pragma message("The GCM module is replaced by an implementation with a constant-time GHASH")
+/*
+ * GCM with a constant-time GHASH. The portable implementation multiplies in
+ * GF(2^128) with 4-bit tables indexed by the data. Here the carry-less
+ * products are computed with integer multiplications of operands with holes,
+ * one bit in four, so that carries never reach a bit that is kept, as done by
+ * ghash_ctmul32 in BearSSL (see the notice of the AES kernel above). A
+ * 128x128 product takes nine 32x32 products with two levels of Karatsuba, each
+ * of them 16 UMULL, which have a fixed latency on Armv8-M Mainline.
+ *
+ * The blocks are read as big-endian integers, so bit i of a block, counting
+ * from the most significant bit of byte 0, is the coefficient of x^i.
+ */
+
+static inline uint64_t gcm_get_be64(const unsigned char *p)
+{
+    return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) |
+           ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+           ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) |
+           ((uint64_t)p[6] << 8) | (uint64_t)p[7];
+}
+
+static inline void gcm_put_be64(unsigned char *p, uint64_t x)
+{
+    unsigned int i;
+
+    for (i = 0; i < 8; i++) {
+        p[i] = (unsigned char)(x >> (56 - (i << 3)));
+    }
+}
+
+static inline void gcm_xor(unsigned char *r, const unsigned char *a,
+                           size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        r[i] ^= a[i];
+    }
+}
+
+/* Carry-less product of two 32-bit words */
+static inline uint64_t gcm_clmul32(uint32_t x, uint32_t y)
+{
+    uint32_t x0, x1, x2, x3, y0, y1, y2, y3;
+    uint64_t z0, z1, z2, z3;
+
+    x0 = x & 0x11111111;
+    x1 = x & 0x22222222;
+    x2 = x & 0x44444444;
+    x3 = x & 0x88888888;
+    y0 = y & 0x11111111;
+    y1 = y & 0x22222222;
+    y2 = y & 0x44444444;
+    y3 = y & 0x88888888;
+
+    z0 = ((uint64_t)x0 * y0) ^ ((uint64_t)x1 * y3) ^
+         ((uint64_t)x2 * y2) ^ ((uint64_t)x3 * y1);
+    z1 = ((uint64_t)x0 * y1) ^ ((uint64_t)x1 * y0) ^
+         ((uint64_t)x2 * y3) ^ ((uint64_t)x3 * y2);
+    z2 = ((uint64_t)x0 * y2) ^ ((uint64_t)x1 * y1) ^
+         ((uint64_t)x2 * y0) ^ ((uint64_t)x3 * y3);
+    z3 = ((uint64_t)x0 * y3) ^ ((uint64_t)x1 * y2) ^
+         ((uint64_t)x2 * y1) ^ ((uint64_t)x3 * y0);
+
+    return (z0 & 0x1111111111111111ULL) | (z1 & 0x2222222222222222ULL) |
+           (z2 & 0x4444444444444444ULL) | (z3 & 0x8888888888888888ULL);
+}
+
+/* Carry-less product of two 64-bit words, with Karatsuba */
+static inline void gcm_clmul64(uint64_t x, uint64_t y,
+                               uint64_t *hi, uint64_t *lo)
+{
+    uint32_t x0 = (uint32_t)x, x1 = (uint32_t)(x >> 32);
+    uint32_t y0 = (uint32_t)y, y1 = (uint32_t)(y >> 32);
+    uint64_t z0, z1, z2;
+
+    z0 = gcm_clmul32(x0, y0);
+    z2 = gcm_clmul32(x1, y1);
+    z1 = gcm_clmul32(x0 ^ x1, y0 ^ y1) ^ z0 ^ z2;
+
+    *lo = z0 ^ (z1 << 32);
+    *hi = z2 ^ (z1 >> 32);
+}
+
+/* x = x * H in GF(2^128), modulo x^128 + x^7 + x^2 + x + 1 */
+static void gcm_mult(const mbedtls_gcm_context *ctx, unsigned char x[16])
+{
+    uint64_t a1 = gcm_get_be64(x), a0 = gcm_get_be64(x + 8);
+    uint64_t b1 = ctx->h[0], b0 = ctx->h[1];
+    uint64_t p1, p0, r1, r0, m1, m0;
+    uint64_t w3, w2, w1, w0, o;
+
+    gcm_clmul64(a0, b0, &p1, &p0);
+    gcm_clmul64(a1, b1, &r1, &r0);
+    gcm_clmul64(a0 ^ a1, b0 ^ b1, &m1, &m0);
+    m1 ^= p1 ^ r1;
+    m0 ^= p0 ^ r0;
+
+    /*
+     * The 255-bit product of the reflected operands is the reflected product
+     * shifted right by one bit. Shift it back, so that (w3, w2) holds the
+     * terms of degree 0 to 127 and (w1, w0) those of degree 128 to 254.
+     */
+    w3 = r1;
+    w2 = r0 ^ m1;
+    w1 = p1 ^ m0;
+    w0 = p0;
+    w3 = (w3 << 1) | (w2 >> 63);
+    w2 = (w2 << 1) | (w1 >> 63);
+    w1 = (w1 << 1) | (w0 >> 63);
+    w0 <<= 1;
+
+    /*
+     * Fold the high terms with x^128 = x^7 + x^2 + x + 1, a multiplication
+     * by x being a right shift. The terms shifted out of (w1, w0) have a
+     * degree of 128 to 134 and are folded once more.
+     */
+    o = (w0 << 63) ^ (w0 << 62) ^ (w0 << 57);
+    o ^= (o >> 1) ^ (o >> 2) ^ (o >> 7);
+    w3 ^= w1 ^ (w1 >> 1) ^ (w1 >> 2) ^ (w1 >> 7) ^ o;
+    w2 ^= w0 ^ ((w0 >> 1) | (w1 << 63)) ^ ((w0 >> 2) | (w1 << 62)) ^
+          ((w0 >> 7) | (w1 << 57));
+
+    gcm_put_be64(x, w3);
+    gcm_put_be64(x + 8, w2);
+}
+
+static int gcm_encrypt_block(mbedtls_gcm_context *ctx,
+                             const unsigned char input[16],
+                             unsigned char output[16])
+{
+    size_t olen = 0;
+
+    return mbedtls_cipher_update(&ctx->cipher_ctx, input, 16, output, &olen);
+}
+
+/* Increment the rightmost 32 bits of the counter block */
+static inline void gcm_incr(unsigned char y[16])
+{
+    unsigned int i;
+
+    for (i = 16; i > 12; i--) {
+        if (++y[i - 1] != 0) {
+            break;
+        }
+    }
+}
+
+void mbedtls_gcm_init(mbedtls_gcm_context *ctx)
+{
+    (void)memset(ctx, 0, sizeof(*ctx));
+}
+
+int mbedtls_gcm_setkey(mbedtls_gcm_context *ctx, mbedtls_cipher_id_t cipher,
+                       const unsigned char *key, unsigned int keybits)
+{
+    const mbedtls_cipher_info_t *cipher_info;
+    unsigned char h[16] = {0};
+    int ret;
+
+    if ((keybits != 128) && (keybits != 192) && (keybits != 256)) {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    cipher_info = mbedtls_cipher_info_from_values(cipher, (int)keybits,
+                                                  MBEDTLS_MODE_ECB);
+    if ((cipher_info == NULL) ||
+        (mbedtls_cipher_info_get_block_size(cipher_info) != 16)) {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    mbedtls_cipher_free(&ctx->cipher_ctx);
+
+    ret = mbedtls_cipher_setup(&ctx->cipher_ctx, cipher_info);
+    if (ret != 0) {
+        return ret;
+    }
+
+    ret = mbedtls_cipher_setkey(&ctx->cipher_ctx, key, (int)keybits,
+                                MBEDTLS_ENCRYPT);
+    if (ret != 0) {
+        return ret;
+    }
+
+    /* H = E(K, 0^128) */
+    ret = gcm_encrypt_block(ctx, h, h);
+    if (ret != 0) {
+        return ret;
+    }
+
+    ctx->h[0] = gcm_get_be64(h);
+    ctx->h[1] = gcm_get_be64(h + 8);
+
+    mbedtls_platform_zeroize(h, sizeof(h));
+
+    return 0;
+}
+
+int mbedtls_gcm_starts(mbedtls_gcm_context *ctx, int mode,
+                       const unsigned char *iv, size_t iv_len)
+{
+    unsigned char len_block[16] = {0};
+    size_t use_len;
+
+    /* The IV is limited to 2^64 bits, i.e. 2^61 bytes */
+    if ((iv_len == 0) || (((uint64_t)iv_len >> 61) != 0)) {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    (void)memset(ctx->y, 0, sizeof(ctx->y));
+    (void)memset(ctx->buf, 0, sizeof(ctx->buf));
+
+    ctx->mode = mode;
+    ctx->len = 0;
+    ctx->add_len = 0;
+
+    if (iv_len == 12) {
+        (void)memcpy(ctx->y, iv, iv_len);
+        ctx->y[15] = 1;
+    } else {
+        gcm_put_be64(len_block + 8, (uint64_t)iv_len * 8);
+
+        while (iv_len > 0) {
+            use_len = (iv_len < 16) ? iv_len : 16;
+            gcm_xor(ctx->y, iv, use_len);
+            gcm_mult(ctx, ctx->y);
+            iv += use_len;
+            iv_len -= use_len;
+        }
+
+        gcm_xor(ctx->y, len_block, sizeof(len_block));
+        gcm_mult(ctx, ctx->y);
+    }
+
+    return gcm_encrypt_block(ctx, ctx->y, ctx->base_ectr);
+}
+
+int mbedtls_gcm_update_ad(mbedtls_gcm_context *ctx,
+                          const unsigned char *add, size_t add_len)
+{
+    uint64_t new_add_len = ctx->add_len + add_len;
+    size_t offset, use_len;
+
+    /* The additional data is limited to 2^64 bits, i.e. 2^61 bytes */
+    if ((new_add_len < ctx->add_len) || ((new_add_len >> 61) != 0)) {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    /* The additional data goes before the data */
+    if ((ctx->len != 0) && (add_len != 0)) {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    offset = (size_t)(ctx->add_len % 16);
+    while (add_len > 0) {
+        use_len = 16 - offset;
+        if (use_len > add_len) {
+            use_len = add_len;
+        }
+
+        gcm_xor(ctx->buf + offset, add, use_len);
+        if ((offset + use_len) == 16) {
+            gcm_mult(ctx, ctx->buf);
+        }
+
+        ctx->add_len += use_len;
+        add += use_len;
+        add_len -= use_len;
+        offset = 0;
+    }
+
+    return 0;
+}
+
+int mbedtls_gcm_update(mbedtls_gcm_context *ctx,
+                       const unsigned char *input, size_t input_length,
+                       unsigned char *output, size_t output_size,
+                       size_t *output_length)
+{
+    size_t offset, use_len, i;
+    unsigned char c;
+    int ret;
+
+    if (output_size < input_length) {
+        return MBEDTLS_ERR_GCM_BUFFER_TOO_SMALL;
+    }
+    *output_length = input_length;
+
+    if (input_length == 0) {
+        return 0;
+    }
+
+    /* The output may be the input, but must not overlap it further on */
+    if ((output > input) && ((size_t)(output - input) < input_length)) {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    /* The data is limited to 2^39 - 256 bits, i.e. 2^36 - 32 bytes */
+    if ((ctx->len + input_length < ctx->len) ||
+        ((ctx->len + input_length) > 0xFFFFFFFE0ULL)) {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    /* Close a partial block of additional data */
+    if ((ctx->len == 0) && ((ctx->add_len % 16) != 0)) {
+        gcm_mult(ctx, ctx->buf);
+    }
+
+    offset = (size_t)(ctx->len % 16);
+    while (input_length > 0) {
+        if (offset == 0) {
+            gcm_incr(ctx->y);
+            ret = gcm_encrypt_block(ctx, ctx->y, ctx->ectr);
+            if (ret != 0) {
+                return ret;
+            }
+        }
+
+        use_len = 16 - offset;
+        if (use_len > input_length) {
+            use_len = input_length;
+        }
+
+        /* GHASH runs on the ciphertext, read before output overwrites it */
+        for (i = 0; i < use_len; i++) {
+            c = input[i] ^ ctx->ectr[offset + i];
+            ctx->buf[offset + i] ^= (ctx->mode == MBEDTLS_GCM_DECRYPT) ?
+                                    input[i] : c;
+            output[i] = c;
+        }
+        if ((offset + use_len) == 16) {
+            gcm_mult(ctx, ctx->buf);
+        }
+
+        ctx->len += use_len;
+        input += use_len;
+        output += use_len;
+        input_length -= use_len;
+        offset = 0;
+    }
+
+    return 0;
+}
+
+int mbedtls_gcm_finish(mbedtls_gcm_context *ctx,
+                       unsigned char *output, size_t output_size,
+                       size_t *output_length,
+                       unsigned char *tag, size_t tag_len)
+{
+    unsigned char len_block[16];
+    size_t i;
+
+    /* All the data has been output by mbedtls_gcm_update() */
+    (void)output;
+    (void)output_size;
+    *output_length = 0;
+
+    if ((tag_len > 16) || (tag_len < 4)) {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    /* Close a partial block of data, or of additional data if no data */
+    if (((ctx->len == 0) && ((ctx->add_len % 16) != 0)) ||
+        ((ctx->len % 16) != 0)) {
+        gcm_mult(ctx, ctx->buf);
+    }
+
+    gcm_put_be64(len_block, ctx->add_len * 8);
+    gcm_put_be64(len_block + 8, ctx->len * 8);
+    gcm_xor(ctx->buf, len_block, sizeof(len_block));
+    gcm_mult(ctx, ctx->buf);
+
+    for (i = 0; i < tag_len; i++) {
+        tag[i] = ctx->base_ectr[i] ^ ctx->buf[i];
+    }
+
+    return 0;
+}
+
+int mbedtls_gcm_crypt_and_tag(mbedtls_gcm_context *ctx, int mode,
+                              size_t length,
+                              const unsigned char *iv, size_t iv_len,
+                              const unsigned char *add, size_t add_len,
+                              const unsigned char *input,
+                              unsigned char *output,
+                              size_t tag_len, unsigned char *tag)
+{
+    size_t olen;
+    int ret;
+
+    ret = mbedtls_gcm_starts(ctx, mode, iv, iv_len);
+    if (ret != 0) {
+        return ret;
+    }
+
+    ret = mbedtls_gcm_update_ad(ctx, add, add_len);
+    if (ret != 0) {
+        return ret;
+    }
+
+    ret = mbedtls_gcm_update(ctx, input, length, output, length, &olen);
+    if (ret != 0) {
+        return ret;
+    }
+
+    return mbedtls_gcm_finish(ctx, NULL, 0, &olen, tag, tag_len);
+}
+
+int mbedtls_gcm_auth_decrypt(mbedtls_gcm_context *ctx,
+                             size_t length,
+                             const unsigned char *iv, size_t iv_len,
+                             const unsigned char *add, size_t add_len,
+                             const unsigned char *tag, size_t tag_len,
+                             const unsigned char *input,
+                             unsigned char *output)
+{
+    unsigned char check_tag[16];
+    unsigned char diff = 0;
+    size_t i;
+    int ret;
+
+    ret = mbedtls_gcm_crypt_and_tag(ctx, MBEDTLS_GCM_DECRYPT, length,
+                                    iv, iv_len, add, add_len,
+                                    input, output, tag_len, check_tag);
+    if (ret != 0) {
+        return ret;
+    }
+
+    /* Compare the tags in constant time */
+    for (i = 0; i < tag_len; i++) {
+        diff |= tag[i] ^ check_tag[i];
+    }
+    mbedtls_platform_zeroize(check_tag, sizeof(check_tag));
+
+    if (diff != 0) {
+        mbedtls_platform_zeroize(output, length);
+        return MBEDTLS_ERR_GCM_AUTH_FAILED;
+    }
+
+    return 0;
+}
+
+void mbedtls_gcm_free(mbedtls_gcm_context *ctx)
+{
+    if (ctx == NULL) {
+        return;
+    }
+
+    mbedtls_cipher_free(&ctx->cipher_ctx);
+    mbedtls_platform_zeroize(ctx, sizeof(*ctx));
+}
+#endif /* MBEDTLS_GCM_ALT */
+
+#if defined(MBEDTLS_SHA256_PROCESS_ALT)
+#pragma message("mbedtls_internal_sha256_process() is replaced by a fully unrolled implementation")
+/*
+ * SHA-256 compression function with the 64 rounds fully unrolled, so that the
+ * working variables are renamed at each round instead of being moved, and
+ * with the message schedule kept in a rolling window of 16 words instead of
+ * the 64 words array used by the portable implementation.
+ */
+
+#define SHA256_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define SHA256_S0(x) (SHA256_ROTR(x, 2) ^ SHA256_ROTR(x, 13) ^ SHA256_ROTR(x, 22))
+#define SHA256_S1(x) (SHA256_ROTR(x, 6) ^ SHA256_ROTR(x, 11) ^ SHA256_ROTR(x, 25))
+#define SHA256_G0(x) (SHA256_ROTR(x, 7) ^ SHA256_ROTR(x, 18) ^ ((x) >> 3))
+#define SHA256_G1(x) (SHA256_ROTR(x, 17) ^ SHA256_ROTR(x, 19) ^ ((x) >> 10))
+
+#define SHA256_CH(x, y, z)  ((z) ^ ((x) & ((y) ^ (z))))
+#define SHA256_MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
+
+/* Message schedule word for round i >= 16, computed in place */
+#define SHA256_W(i)                                                  \
+    (w[(i) & 15] += SHA256_G1(w[((i) - 2) & 15]) + w[((i) - 7) & 15] + \
+                    SHA256_G0(w[((i) - 15) & 15]))
+
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, k, wi)               \
+    do {                                                          \
+        uint32_t t1 = (h) + SHA256_S1(e) + SHA256_CH(e, f, g) + (k) + (wi); \
+        (d) += t1;                                                \
+        (h) = t1 + SHA256_S0(a) + SHA256_MAJ(a, b, c);            \
+    } while (0)
+
+/* Eight rounds, after which the working variables are back in place */
+#define SHA256_ROUNDS_0_15(i)                                                   \
+    do {                                                                        \
+        SHA256_ROUND(a, b, c, d, e, f, g, h, k[(i) + 0], w[(i) + 0]); \
+        SHA256_ROUND(h, a, b, c, d, e, f, g, k[(i) + 1], w[(i) + 1]); \
+        SHA256_ROUND(g, h, a, b, c, d, e, f, k[(i) + 2], w[(i) + 2]); \
+        SHA256_ROUND(f, g, h, a, b, c, d, e, k[(i) + 3], w[(i) + 3]); \
+        SHA256_ROUND(e, f, g, h, a, b, c, d, k[(i) + 4], w[(i) + 4]); \
+        SHA256_ROUND(d, e, f, g, h, a, b, c, k[(i) + 5], w[(i) + 5]); \
+        SHA256_ROUND(c, d, e, f, g, h, a, b, k[(i) + 6], w[(i) + 6]); \
+        SHA256_ROUND(b, c, d, e, f, g, h, a, k[(i) + 7], w[(i) + 7]); \
+    } while (0)
+
+#define SHA256_ROUNDS_16_63(i)                                                      \
+    do {                                                                            \
+        SHA256_ROUND(a, b, c, d, e, f, g, h, k[(i) + 0], SHA256_W((i) + 0)); \
+        SHA256_ROUND(h, a, b, c, d, e, f, g, k[(i) + 1], SHA256_W((i) + 1)); \
+        SHA256_ROUND(g, h, a, b, c, d, e, f, k[(i) + 2], SHA256_W((i) + 2)); \
+        SHA256_ROUND(f, g, h, a, b, c, d, e, k[(i) + 3], SHA256_W((i) + 3)); \
+        SHA256_ROUND(e, f, g, h, a, b, c, d, k[(i) + 4], SHA256_W((i) + 4)); \
+        SHA256_ROUND(d, e, f, g, h, a, b, c, k[(i) + 5], SHA256_W((i) + 5)); \
+        SHA256_ROUND(c, d, e, f, g, h, a, b, k[(i) + 6], SHA256_W((i) + 6)); \
+        SHA256_ROUND(b, c, d, e, f, g, h, a, k[(i) + 7], SHA256_W((i) + 7)); \
+    } while (0)
+
+int mbedtls_internal_sha256_process(mbedtls_sha256_context *ctx,
+                                    const unsigned char data[64])
+{
+    static const uint32_t k[64] = {
+        0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+        0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+        0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+        0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+        0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+        0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+        0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+        0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+        0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+        0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+        0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+        0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+        0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+        0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+        0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+        0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+    };
+    uint32_t w[16];
+    uint32_t a, b, c, d, e, f, g, h;
+    unsigned int i;
+
+    for (i = 0; i < 16; i++) {
+        w[i] = ((uint32_t)data[(i << 2) + 0] << 24) |
+               ((uint32_t)data[(i << 2) + 1] << 16) |
+               ((uint32_t)data[(i << 2) + 2] << 8) |
+               ((uint32_t)data[(i << 2) + 3]);
+    }
+
+    a = ctx->state[0];
+    b = ctx->state[1];
+    c = ctx->state[2];
+    d = ctx->state[3];
+    e = ctx->state[4];
+    f = ctx->state[5];
+    g = ctx->state[6];
+    h = ctx->state[7];
+
+    SHA256_ROUNDS_0_15(0);
+    SHA256_ROUNDS_0_15(8);
+    SHA256_ROUNDS_16_63(16);
+    SHA256_ROUNDS_16_63(24);
+    SHA256_ROUNDS_16_63(32);
+    SHA256_ROUNDS_16_63(40);
+    SHA256_ROUNDS_16_63(48);
+    SHA256_ROUNDS_16_63(56);
+
+    ctx->state[0] += a;
+    ctx->state[1] += b;
+    ctx->state[2] += c;
+    ctx->state[3] += d;
+    ctx->state[4] += e;
+    ctx->state[5] += f;
+    ctx->state[6] += g;
+    ctx->state[7] += h;
+
+    mbedtls_platform_zeroize(w, sizeof(w));
+
+    return 0;
+}
+#endif /* MBEDTLS_SHA256_PROCESS_ALT */
@@ -1,10 +1,14 @@
 /*
  * Copyright (c) 2021-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
+#include <stdbool.h>
 #include <string.h>
+#include "config_tfm.h"
 #include "psa/crypto.h"
 #include "psa/error.h"
 #include "tfm_sp_log.h"
@@ -16,11 +20,31 @@
 #include "tfm_bootloader_fwu_abstraction.h"
 #include "tfm_boot_status.h"
 #include "service_api.h"
+#if FWU_ERASE_AHEAD_SIZE > 0
+#include "flash_layout.h"
+#endif
+#if FWU_DELTA_UPDATE
+#include "tfm_fwu_delta.h"
+#endif
+#if FWU_COMPRESSED_UPDATE
+#include "tfm_fwu_decompress.h"
+#endif
 
 #if (FWU_COMPONENT_NUMBER != MCUBOOT_IMAGE_NUMBER)
     #error "FWU_COMPONENT_NUMBER mismatch with MCUBOOT_IMAGE_NUMBER"
 #endif
 
+#if (FWU_ERASE_AHEAD_SIZE > 0) && !defined(FLASH_AREA_IMAGE_SECTOR_SIZE)
+    #error "FWU_ERASE_AHEAD_SIZE requires FLASH_AREA_IMAGE_SECTOR_SIZE"
+#endif
+
+/* A delta image is applied to the image in the primary slot, which must then
+ * be the active one.
+ */
+#if FWU_DELTA_UPDATE && (defined(MCUBOOT_DIRECT_XIP) || defined(MCUBOOT_RAM_LOAD))
+    #error "FWU_DELTA_UPDATE is not supported with MCUBOOT_DIRECT_XIP or MCUBOOT_RAM_LOAD"
+#endif
+
 #define MAX_IMAGE_INFO_LENGTH   (MCUBOOT_IMAGE_NUMBER * \
                                 (sizeof(struct image_version) + \
                                  SHARED_DATA_ENTRY_HEADER_SIZE))
@@ -44,10 +68,54 @@ typedef struct tfm_fwu_mcuboot_ctx_s {
 
     /* The size of the downloaded data in the FWU process. */
     size_t loaded_size;
+
+#if FWU_STREAMING_DIGEST
+    /* Running hash of the image, valid while the blocks are written in
+     * order, from the start of the image up to hashed_size.
+     */
+    psa_hash_operation_t hash_op;
+    size_t hashed_size;
+    bool hash_valid;
+#endif
+
+#if FWU_ERASE_AHEAD_SIZE > 0
+    /* The staging area is erased from its start up to erased_size. */
+    size_t erased_size;
+#endif
+
+#if FWU_DELTA_UPDATE
+    /* The flash area of the active image, open while a delta image is
+     * loaded.
+     */
+    const struct flash_area *src_fap;
+
+    /* The size of the patch received so far. */
+    size_t patch_size;
+
+    struct fwu_delta_ctx_t delta;
+#endif
+
+#if FWU_COMPRESSED_UPDATE
+    /* A compressed image is being loaded. */
+    bool decompressing;
+
+    /* The size of the compressed stream received so far. */
+    size_t stream_size;
+
+    struct fwu_decompress_ctx_t decompress;
+#endif
 } tfm_fwu_mcuboot_ctx_t;
 
+/* Active image version of a component, extracted from the shared data */
+typedef struct fwu_active_image_version_s {
+    bool found;                   /* A version entry exists */
+    bool valid;                   /* The version entry is well formed */
+    struct image_version version;
+} fwu_active_image_version_t;
+
 static tfm_fwu_mcuboot_ctx_t mcuboot_ctx[FWU_COMPONENT_NUMBER];
 static fwu_image_info_data_t __attribute__((aligned(4))) boot_shared_data;
+static fwu_active_image_version_t active_image_version[FWU_COMPONENT_NUMBER];
 
 static psa_status_t fwu_bootloader_get_shared_data(void)
 {
@@ -56,18 +124,21 @@ static psa_status_t fwu_bootloader_get_shared_data(void)
                                   sizeof(boot_shared_data));
 }
 
-static psa_status_t get_active_image_version(psa_fwu_component_t component,
-                                             struct image_version *image_ver)
+/* Index the image versions written by the bootloader into the memory which is
+ * shared between MCUboot and TF-M, so that they are not searched for on each
+ * request.
+ */
+static void index_active_image_versions(void)
 {
     struct shared_data_tlv_entry tlv_entry;
     uint8_t *tlv_end;
     uint8_t *tlv_curr;
+    uint8_t component;
+
+    memset(active_image_version, 0, sizeof(active_image_version));
 
-    /* The bootloader writes the image version information into the memory which
-     * is shared between MCUboot and TF-M. Read the shared memory.
-     */
     if (boot_shared_data.header.tlv_magic != SHARED_DATA_TLV_INFO_MAGIC) {
-        return PSA_ERROR_DATA_CORRUPT;
+        return;
     }
 
     tlv_end = (uint8_t *)&boot_shared_data +
@@ -76,27 +147,233 @@ static psa_status_t get_active_image_version(psa_fwu_component_t component,
 
     while (tlv_curr < tlv_end) {
         (void)memcpy(&tlv_entry, tlv_curr, SHARED_DATA_ENTRY_HEADER_SIZE);
+        component = GET_FWU_MODULE(tlv_entry.tlv_type);
+        /* Only the first version entry of a component is relevant */
         if ((GET_FWU_CLAIM(tlv_entry.tlv_type) == SW_VERSION) &&
-            (GET_FWU_MODULE(tlv_entry.tlv_type) == component)) {
-            if (tlv_entry.tlv_len != sizeof(struct image_version)) {
-                return PSA_ERROR_DATA_CORRUPT;
+            (component < FWU_COMPONENT_NUMBER) &&
+            !active_image_version[component].found) {
+            active_image_version[component].found = true;
+            if (tlv_entry.tlv_len == sizeof(struct image_version)) {
+                memcpy(&active_image_version[component].version,
+                       tlv_curr + SHARED_DATA_ENTRY_HEADER_SIZE,
+                       tlv_entry.tlv_len);
+                active_image_version[component].valid = true;
             }
-            memcpy(image_ver,
-                tlv_curr + SHARED_DATA_ENTRY_HEADER_SIZE,
-                tlv_entry.tlv_len);
-            return PSA_SUCCESS;
         }
         tlv_curr += SHARED_DATA_ENTRY_HEADER_SIZE + tlv_entry.tlv_len;
     }
+}
+
+static psa_status_t get_active_image_version(psa_fwu_component_t component,
+                                             struct image_version *image_ver)
+{
+    if ((component >= FWU_COMPONENT_NUMBER) ||
+        !active_image_version[component].valid) {
+        return PSA_ERROR_DATA_CORRUPT;
+    }
+
+    memcpy(image_ver, &active_image_version[component].version,
+           sizeof(struct image_version));
+
+    return PSA_SUCCESS;
+}
+
+#if FWU_STREAMING_DIGEST
+static void stream_hash_stop(tfm_fwu_mcuboot_ctx_t *ctx)
+{
+    if (ctx->hash_valid) {
+        (void)psa_hash_abort(&ctx->hash_op);
+        ctx->hash_valid = false;
+    }
+}
+
+static void stream_hash_start(tfm_fwu_mcuboot_ctx_t *ctx)
+{
+    /* A hash left over from a previous update is discarded */
+    stream_hash_stop(ctx);
+    ctx->hash_op = psa_hash_operation_init();
+    ctx->hashed_size = 0;
+    ctx->hash_valid = (psa_hash_setup(&ctx->hash_op, PSA_ALG_SHA_256) ==
+                       PSA_SUCCESS);
+}
+
+static void stream_hash_update(tfm_fwu_mcuboot_ctx_t *ctx,
+                               size_t block_offset,
+                               const void *block,
+                               size_t block_size)
+{
+    if (!ctx->hash_valid) {
+        return;
+    }
+
+    /* Only a block written in order extends the hash. Otherwise the digest is
+     * computed from flash.
+     */
+    if ((block_offset != ctx->hashed_size) ||
+        (psa_hash_update(&ctx->hash_op, block, block_size) != PSA_SUCCESS)) {
+        stream_hash_stop(ctx);
+        return;
+    }
+
+    ctx->hashed_size += block_size;
+}
+#endif /* FWU_STREAMING_DIGEST */
+
+#if FWU_ERASE_AHEAD_SIZE > 0
+/* Make sure the staging area is erased up to end, erasing whole sectors up to
+ * FWU_ERASE_AHEAD_SIZE bytes beyond it so that the following blocks do not
+ * need an erase.
+ */
+static psa_status_t erase_ahead(tfm_fwu_mcuboot_ctx_t *ctx, size_t end)
+{
+    const struct flash_area *fap = ctx->fap;
+    size_t erase_end;
+
+    if (end <= ctx->erased_size) {
+        return PSA_SUCCESS;
+    }
+
+    if (end > fap->fa_size) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    erase_end = ALIGN_UP(end + FWU_ERASE_AHEAD_SIZE,
+                         FLASH_AREA_IMAGE_SECTOR_SIZE);
+    if (erase_end > fap->fa_size) {
+        erase_end = fap->fa_size;
+    }
+
+    if (flash_area_erase(fap, ctx->erased_size,
+                         erase_end - ctx->erased_size) != 0) {
+        LOG_ERRFMT("TFM FWU: erasing flash failed.\r\n");
+        return PSA_ERROR_STORAGE_FAILURE;
+    }
+    ctx->erased_size = erase_end;
+
+    return PSA_SUCCESS;
+}
+#endif /* FWU_ERASE_AHEAD_SIZE > 0 */
+
+/* Write to the staging area and account for the written data */
+static psa_status_t staging_write(tfm_fwu_mcuboot_ctx_t *ctx,
+                                  size_t offset,
+                                  const void *buf,
+                                  size_t len)
+{
+    const struct flash_area *fap = ctx->fap;
+#if FWU_ERASE_AHEAD_SIZE > 0
+    psa_status_t status;
+
+    if ((len > fap->fa_size) || (offset > fap->fa_size - len)) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    status = erase_ahead(ctx, offset + len);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+#endif
+
+    if (flash_area_write(fap, offset, buf, len) != 0) {
+        LOG_ERRFMT("TFM FWU: write flash failed.\r\n");
+        return PSA_ERROR_STORAGE_FAILURE;
+    }
+
+#if FWU_STREAMING_DIGEST
+    stream_hash_update(ctx, offset, buf, len);
+#endif
+
+    /* The overflow check has been done in flash_area_write. */
+    ctx->loaded_size += len;
+    return PSA_SUCCESS;
+}
+
+#if FWU_DELTA_UPDATE
+static psa_status_t delta_read_source(void *priv, size_t offset,
+                                      void *buf, size_t len)
+{
+    tfm_fwu_mcuboot_ctx_t *ctx = (tfm_fwu_mcuboot_ctx_t *)priv;
+
+    /* The decoder keeps the reads within the source flash area */
+    if (flash_area_read(ctx->src_fap, offset, buf, len) != 0) {
+        LOG_ERRFMT("TFM FWU: read flash failed.\r\n");
+        return PSA_ERROR_STORAGE_FAILURE;
+    }
+
+    return PSA_SUCCESS;
+}
+
+static psa_status_t delta_write_target(void *priv, size_t offset,
+                                       const void *buf, size_t len)
+{
+    return staging_write((tfm_fwu_mcuboot_ctx_t *)priv, offset, buf, len);
+}
+
+static psa_status_t delta_start(psa_fwu_component_t component)
+{
+    tfm_fwu_mcuboot_ctx_t *ctx = &mcuboot_ctx[component];
+
+    if (flash_area_open(FLASH_AREA_IMAGE_PRIMARY(component),
+                        &ctx->src_fap) != 0) {
+        LOG_ERRFMT("TFM FWU: opening flash failed.\r\n");
+        ctx->src_fap = NULL;
+        return PSA_ERROR_STORAGE_FAILURE;
+    }
+
+    ctx->patch_size = 0;
+    fwu_delta_start(&ctx->delta, delta_read_source, delta_write_target, ctx,
+                    ctx->src_fap->fa_size);
+
+    return PSA_SUCCESS;
+}
+
+static void delta_stop(tfm_fwu_mcuboot_ctx_t *ctx)
+{
+    if (ctx->src_fap != NULL) {
+        flash_area_close(ctx->src_fap);
+        ctx->src_fap = NULL;
+    }
+    ctx->patch_size = 0;
+}
+
+/* Apply the next block of a delta image. The blocks of the patch must be
+ * written in order, as the new image is produced sequentially.
+ */
+static psa_status_t delta_load_block(tfm_fwu_mcuboot_ctx_t *ctx,
+                                     size_t block_offset,
+                                     const void *block,
+                                     size_t block_size)
+{
+    psa_status_t status;
+
+    if (block_offset != ctx->patch_size) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    status = fwu_delta_update(&ctx->delta, (const uint8_t *)block, block_size);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
 
-    return PSA_ERROR_DATA_CORRUPT;
+    ctx->patch_size += block_size;
+    return PSA_SUCCESS;
 }
+#endif /* FWU_DELTA_UPDATE */
+
+#if FWU_COMPRESSED_UPDATE
+static void decompress_stop(tfm_fwu_mcuboot_ctx_t *ctx)
+{
+    ctx->decompressing = false;
+    ctx->stream_size = 0;
+}
+#endif
 
 psa_status_t fwu_bootloader_init(void)
 {
     if (fwu_bootloader_get_shared_data() != PSA_SUCCESS) {
         return PSA_ERROR_STORAGE_FAILURE;
     }
+    index_active_image_versions();
     /* add Init of specific flash driver */
     if (flash_area_driver_init()) {
         return PSA_ERROR_STORAGE_FAILURE;
@@ -122,45 +399,132 @@ psa_status_t fwu_bootloader_staging_area_init(psa_fwu_component_t component,
         return PSA_ERROR_STORAGE_FAILURE;
     }
 
+#if FWU_ERASE_AHEAD_SIZE > 0
+    /* The staging area is erased as the image is written */
+    mcuboot_ctx[component].erased_size = 0;
+#else
     if (flash_area_erase(fap, 0, fap->fa_size) != 0) {
         LOG_ERRFMT("TFM FWU: erasing flash failed.\r\n");
         return PSA_ERROR_GENERIC_ERROR;
     }
+#endif
 
     mcuboot_ctx[component].fap = fap;
 
     /* Reset the loaded_size. */
     mcuboot_ctx[component].loaded_size = 0;
 
+#if FWU_STREAMING_DIGEST
+    stream_hash_start(&mcuboot_ctx[component]);
+#endif
+#if FWU_DELTA_UPDATE
+    delta_stop(&mcuboot_ctx[component]);
+#endif
+#if FWU_COMPRESSED_UPDATE
+    decompress_stop(&mcuboot_ctx[component]);
+#endif
+
+    return PSA_SUCCESS;
+}
+
+/* Load a block of the image, once decompressed */
+static psa_status_t load_block(psa_fwu_component_t component,
+                               size_t block_offset,
+                               const void *block,
+                               size_t block_size)
+{
+#if FWU_DELTA_UPDATE
+    psa_status_t status;
+
+    /* A delta image is recognised by the header of its first block */
+    if ((block_offset == 0) && (mcuboot_ctx[component].src_fap == NULL) &&
+        (mcuboot_ctx[component].loaded_size == 0) &&
+        fwu_delta_is_patch(block, block_size)) {
+        status = delta_start(component);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+    }
+
+    if (mcuboot_ctx[component].src_fap != NULL) {
+        return delta_load_block(&mcuboot_ctx[component], block_offset, block,
+                                block_size);
+    }
+#endif
+
+    return staging_write(&mcuboot_ctx[component], block_offset, block,
+                         block_size);
+}
+
+#if FWU_COMPRESSED_UPDATE
+static psa_status_t decompress_write(void *priv, size_t offset,
+                                     const void *buf, size_t len)
+{
+    tfm_fwu_mcuboot_ctx_t *ctx = (tfm_fwu_mcuboot_ctx_t *)priv;
+
+    return load_block((psa_fwu_component_t)(ctx - mcuboot_ctx), offset, buf,
+                      len);
+}
+
+/* Decompress the next block of a compressed image. The blocks of the stream
+ * must be written in order.
+ */
+static psa_status_t decompress_load_block(tfm_fwu_mcuboot_ctx_t *ctx,
+                                          size_t block_offset,
+                                          const void *block,
+                                          size_t block_size)
+{
+    psa_status_t status;
+
+    if (block_offset != ctx->stream_size) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    status = fwu_decompress_update(&ctx->decompress, (const uint8_t *)block,
+                                   block_size);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    ctx->stream_size += block_size;
     return PSA_SUCCESS;
 }
+#endif /* FWU_COMPRESSED_UPDATE */
 
 psa_status_t fwu_bootloader_load_image(psa_fwu_component_t component,
                                        size_t block_offset,
                                        const void *block,
                                        size_t block_size)
 {
-    const struct flash_area *fap;
-
     if (block == NULL || component >= FWU_COMPONENT_NUMBER) {
         return PSA_ERROR_INVALID_ARGUMENT;
     }
 
     /* The component should already be added into the mcuboot_ctx. */
-    if (mcuboot_ctx[component].fap != NULL) {
-        fap = mcuboot_ctx[component].fap;
-    } else {
+    if (mcuboot_ctx[component].fap == NULL) {
         return PSA_ERROR_BAD_STATE;
     }
 
-    if (flash_area_write(fap, block_offset, block, block_size) != 0) {
-        LOG_ERRFMT("TFM FWU: write flash failed.\r\n");
-        return PSA_ERROR_STORAGE_FAILURE;
+#if FWU_COMPRESSED_UPDATE
+    /* A compressed image is recognised by the header of its first block. It
+     * may hold a delta image, which is detected once decompressed.
+     */
+    if ((block_offset == 0) && !mcuboot_ctx[component].decompressing &&
+        (mcuboot_ctx[component].loaded_size == 0) &&
+        fwu_decompress_is_compressed(block, block_size)) {
+        mcuboot_ctx[component].decompressing = true;
+        mcuboot_ctx[component].stream_size = 0;
+        fwu_decompress_start(&mcuboot_ctx[component].decompress,
+                             decompress_write, &mcuboot_ctx[component]);
     }
 
-    /* The overflow check has been done in flash_area_write. */
-    mcuboot_ctx[component].loaded_size += block_size;
-    return PSA_SUCCESS;
+    if (mcuboot_ctx[component].decompressing) {
+        return decompress_load_block(&mcuboot_ctx[component], block_offset,
+                                     block, block_size);
+    }
+#endif
+
+    return load_block(component, block_offset, block, block_size);
 }
 
 #if (MCUBOOT_IMAGE_NUMBER > 1)
@@ -324,6 +688,46 @@ psa_status_t fwu_bootloader_install_image(const psa_fwu_component_t *candidates,
     }
 #endif
 
+#if FWU_DELTA_UPDATE
+    /* A delta image must have been applied entirely */
+    for (cand_index = 0; cand_index < number; cand_index++) {
+        if ((candidates[cand_index] < FWU_COMPONENT_NUMBER) &&
+            (mcuboot_ctx[candidates[cand_index]].src_fap != NULL) &&
+            !fwu_delta_is_complete(&mcuboot_ctx[candidates[cand_index]].delta)) {
+            return PSA_ERROR_DATA_CORRUPT;
+        }
+    }
+#endif
+
+#if FWU_COMPRESSED_UPDATE
+    /* A compressed image must have been decompressed entirely */
+    for (cand_index = 0; cand_index < number; cand_index++) {
+        if ((candidates[cand_index] < FWU_COMPONENT_NUMBER) &&
+            mcuboot_ctx[candidates[cand_index]].decompressing &&
+            !fwu_decompress_is_complete(
+                &mcuboot_ctx[candidates[cand_index]].decompress)) {
+            return PSA_ERROR_DATA_CORRUPT;
+        }
+    }
+#endif
+
+#if FWU_ERASE_AHEAD_SIZE > 0
+    /* The trailer and what is left of the staging areas must be erased
+     * before the images are marked as pending.
+     */
+    for (cand_index = 0; cand_index < number; cand_index++) {
+        if ((candidates[cand_index] >= FWU_COMPONENT_NUMBER) ||
+            (mcuboot_ctx[candidates[cand_index]].fap == NULL)) {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        if (erase_ahead(&mcuboot_ctx[candidates[cand_index]],
+                        mcuboot_ctx[candidates[cand_index]].fap->fa_size) !=
+            PSA_SUCCESS) {
+            return PSA_ERROR_STORAGE_FAILURE;
+        }
+    }
+#endif
+
     /* Write the boot magic in image trailer so that these images will be
      * taken as candidates.
      */
@@ -498,6 +902,15 @@ psa_status_t fwu_bootloader_abort(psa_fwu_component_t component)
     flash_area_close(fap);
     mcuboot_ctx[component].fap = NULL;
     mcuboot_ctx[component].loaded_size = 0;
+#if FWU_STREAMING_DIGEST
+    stream_hash_stop(&mcuboot_ctx[component]);
+#endif
+#if FWU_DELTA_UPDATE
+    delta_stop(&mcuboot_ctx[component]);
+#endif
+#if FWU_COMPRESSED_UPDATE
+    decompress_stop(&mcuboot_ctx[component]);
+#endif
     return PSA_SUCCESS;
 }
 
@@ -549,6 +962,9 @@ static psa_status_t get_second_image_digest(psa_fwu_component_t component,
     size_t hash_size = 0;
     psa_status_t ret = PSA_SUCCESS;
     size_t data_size;
+#if FWU_STREAMING_DIGEST
+    psa_hash_operation_t hash_op = psa_hash_operation_init();
+#endif
 
     if (component >= FWU_COMPONENT_NUMBER) {
         return PSA_ERROR_INVALID_ARGUMENT;
@@ -561,6 +977,23 @@ static psa_status_t get_second_image_digest(psa_fwu_component_t component,
     } else {
         return PSA_ERROR_INVALID_ARGUMENT;
     }
+
+#if FWU_STREAMING_DIGEST
+    /* The running hash covers all of the downloaded data, finish a copy of it
+     * so that more blocks can still be added.
+     */
+    if (mcuboot_ctx[component].hash_valid &&
+        (mcuboot_ctx[component].hashed_size == data_size)) {
+        if ((psa_hash_clone(&mcuboot_ctx[component].hash_op,
+                            &hash_op) == PSA_SUCCESS) &&
+            (psa_hash_finish(&hash_op, hash, sizeof(hash),
+                             &hash_size) == PSA_SUCCESS)) {
+            memcpy(info->impl.candidate_digest, hash, hash_size);
+            return PSA_SUCCESS;
+        }
+        (void)psa_hash_abort(&hash_op);
+    }
+#endif
     if ((flash_area_open(FLASH_AREA_IMAGE_SECONDARY(component),
                             &fap)) != 0) {
         LOG_ERRFMT("TFM FWU: opening flash failed.\r\n");
@@ -666,6 +1099,15 @@ psa_status_t fwu_bootloader_clean_component(psa_fwu_component_t component)
             return PSA_ERROR_STORAGE_FAILURE;
         }
         mcuboot_ctx[component].fap = NULL;
+#if FWU_STREAMING_DIGEST
+        stream_hash_stop(&mcuboot_ctx[component]);
+#endif
+#if FWU_DELTA_UPDATE
+        delta_stop(&mcuboot_ctx[component]);
+#endif
+#if FWU_COMPRESSED_UPDATE
+        decompress_stop(&mcuboot_ctx[component]);
+#endif
     } else {
         return PSA_ERROR_DOES_NOT_EXIST;
     }
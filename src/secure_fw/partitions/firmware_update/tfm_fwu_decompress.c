@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "config_tfm.h"
+
+#if FWU_COMPRESSED_UPDATE
+
+#include "tfm_fwu_decompress.h"
+
+enum fwu_decompress_state_t {
+    FWU_DECOMPRESS_STATE_HEADER = 0,
+    FWU_DECOMPRESS_STATE_TAG,
+    FWU_DECOMPRESS_STATE_LITERAL,
+    FWU_DECOMPRESS_STATE_INDEX,
+    FWU_DECOMPRESS_STATE_COUNT,
+    FWU_DECOMPRESS_STATE_YIELD,
+    FWU_DECOMPRESS_STATE_DONE,
+    FWU_DECOMPRESS_STATE_ERROR,
+};
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void next_state(struct fwu_decompress_ctx_t *ctx, uint32_t state,
+                       uint32_t bits)
+{
+    ctx->state = state;
+    ctx->bits_wanted = bits;
+    ctx->bits_acc = 0;
+}
+
+/* Read ctx->bits_wanted bits into ctx->bits_acc, most significant bit first.
+ * Returns false if the input runs out first, the bits read so far are kept.
+ */
+static bool read_bits(struct fwu_decompress_ctx_t *ctx,
+                      const uint8_t **data, size_t *len)
+{
+    while (ctx->bits_wanted > 0) {
+        if (ctx->bit_count == 0) {
+            if (*len == 0) {
+                return false;
+            }
+            ctx->bit_byte = **data;
+            ctx->bit_count = 8;
+            (*data)++;
+            (*len)--;
+        }
+        ctx->bit_count--;
+        ctx->bits_acc = (ctx->bits_acc << 1) |
+                        ((ctx->bit_byte >> ctx->bit_count) & 1u);
+        ctx->bits_wanted--;
+    }
+
+    return true;
+}
+
+/* Append a byte to the window and to the output, flushing the output once
+ * full or once the image is complete.
+ */
+static psa_status_t output_byte(struct fwu_decompress_ctx_t *ctx, uint8_t byte)
+{
+    psa_status_t status;
+
+    ctx->window[ctx->head] = byte;
+    ctx->head = (ctx->head + 1) & (FWU_DECOMPRESS_WINDOW_SIZE - 1);
+    ctx->out_buf[ctx->out_len++] = byte;
+
+    if ((ctx->out_len == sizeof(ctx->out_buf)) ||
+        ((ctx->flushed + ctx->out_len) == ctx->target_size)) {
+        status = ctx->write(ctx->priv, ctx->flushed, ctx->out_buf,
+                            ctx->out_len);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+        ctx->flushed += ctx->out_len;
+        ctx->out_len = 0;
+    }
+
+    return PSA_SUCCESS;
+}
+
+static bool is_done(const struct fwu_decompress_ctx_t *ctx)
+{
+    return (ctx->flushed + ctx->out_len) == ctx->target_size;
+}
+
+static psa_status_t parse_header(struct fwu_decompress_ctx_t *ctx)
+{
+    const uint8_t *header = ctx->header;
+
+    if ((get_le32(header) != FWU_DECOMPRESS_MAGIC) ||
+        (header[6] != 0) || (header[7] != 0)) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    ctx->window_bits = header[4];
+    ctx->lookahead_bits = header[5];
+    ctx->target_size = get_le32(&header[8]);
+
+    /* Same limits as heatshrink */
+    if ((ctx->window_bits < 4) || (ctx->lookahead_bits < 3) ||
+        (ctx->lookahead_bits >= ctx->window_bits)) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if (ctx->window_bits > FWU_COMPRESS_WINDOW_BITS) {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+
+    return PSA_SUCCESS;
+}
+
+static psa_status_t decode(struct fwu_decompress_ctx_t *ctx,
+                           const uint8_t *data, size_t len)
+{
+    psa_status_t status;
+    size_t chunk;
+
+    for (;;) {
+        switch (ctx->state) {
+        case FWU_DECOMPRESS_STATE_HEADER:
+            if (len == 0) {
+                return PSA_SUCCESS;
+            }
+            chunk = FWU_DECOMPRESS_HEADER_SIZE - ctx->header_len;
+            if (chunk > len) {
+                chunk = len;
+            }
+            (void)memcpy(&ctx->header[ctx->header_len], data, chunk);
+            ctx->header_len += chunk;
+            data += chunk;
+            len -= chunk;
+
+            if (ctx->header_len == FWU_DECOMPRESS_HEADER_SIZE) {
+                status = parse_header(ctx);
+                if (status != PSA_SUCCESS) {
+                    return status;
+                }
+                next_state(ctx, is_done(ctx) ? FWU_DECOMPRESS_STATE_DONE :
+                                               FWU_DECOMPRESS_STATE_TAG, 1);
+            }
+            break;
+
+        case FWU_DECOMPRESS_STATE_TAG:
+            if (!read_bits(ctx, &data, &len)) {
+                return PSA_SUCCESS;
+            }
+            if (ctx->bits_acc != 0) {
+                next_state(ctx, FWU_DECOMPRESS_STATE_LITERAL, 8);
+            } else {
+                next_state(ctx, FWU_DECOMPRESS_STATE_INDEX, ctx->window_bits);
+            }
+            break;
+
+        case FWU_DECOMPRESS_STATE_LITERAL:
+            if (!read_bits(ctx, &data, &len)) {
+                return PSA_SUCCESS;
+            }
+            status = output_byte(ctx, (uint8_t)ctx->bits_acc);
+            if (status != PSA_SUCCESS) {
+                return status;
+            }
+            next_state(ctx, is_done(ctx) ? FWU_DECOMPRESS_STATE_DONE :
+                                           FWU_DECOMPRESS_STATE_TAG, 1);
+            break;
+
+        case FWU_DECOMPRESS_STATE_INDEX:
+            if (!read_bits(ctx, &data, &len)) {
+                return PSA_SUCCESS;
+            }
+            ctx->index = ctx->bits_acc + 1;
+            next_state(ctx, FWU_DECOMPRESS_STATE_COUNT, ctx->lookahead_bits);
+            break;
+
+        case FWU_DECOMPRESS_STATE_COUNT:
+            if (!read_bits(ctx, &data, &len)) {
+                return PSA_SUCCESS;
+            }
+            ctx->count = ctx->bits_acc + 1;
+            if (ctx->count > (ctx->target_size - ctx->flushed - ctx->out_len)) {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+            next_state(ctx, FWU_DECOMPRESS_STATE_YIELD, 0);
+            break;
+
+        case FWU_DECOMPRESS_STATE_YIELD:
+            while (ctx->count > 0) {
+                status = output_byte(ctx, ctx->window[
+                    (ctx->head - ctx->index) & (FWU_DECOMPRESS_WINDOW_SIZE - 1)]);
+                if (status != PSA_SUCCESS) {
+                    return status;
+                }
+                ctx->count--;
+            }
+            next_state(ctx, is_done(ctx) ? FWU_DECOMPRESS_STATE_DONE :
+                                           FWU_DECOMPRESS_STATE_TAG, 1);
+            break;
+
+        default:
+            /* The padding bits of the last byte are ignored, anything after
+             * it is not part of the stream.
+             */
+            return (len == 0) ? PSA_SUCCESS : PSA_ERROR_INVALID_ARGUMENT;
+        }
+    }
+}
+
+bool fwu_decompress_is_compressed(const void *block, size_t block_size)
+{
+    if (block_size < FWU_DECOMPRESS_HEADER_SIZE) {
+        return false;
+    }
+
+    return get_le32((const uint8_t *)block) == FWU_DECOMPRESS_MAGIC;
+}
+
+void fwu_decompress_start(struct fwu_decompress_ctx_t *ctx,
+                          fwu_decompress_write_t write,
+                          void *priv)
+{
+    /* The window starts zeroed, as in heatshrink */
+    (void)memset(ctx, 0, sizeof(*ctx));
+
+    ctx->write = write;
+    ctx->priv = priv;
+    ctx->state = FWU_DECOMPRESS_STATE_HEADER;
+}
+
+psa_status_t fwu_decompress_update(struct fwu_decompress_ctx_t *ctx,
+                                   const uint8_t *data, size_t len)
+{
+    psa_status_t status;
+
+    if (ctx->state == FWU_DECOMPRESS_STATE_ERROR) {
+        return PSA_ERROR_BAD_STATE;
+    }
+
+    /* The decompressor cannot resume from the middle of a failed block */
+    status = decode(ctx, data, len);
+    if (status != PSA_SUCCESS) {
+        ctx->state = FWU_DECOMPRESS_STATE_ERROR;
+    }
+
+    return status;
+}
+
+bool fwu_decompress_is_complete(const struct fwu_decompress_ctx_t *ctx)
+{
+    return ctx->state == FWU_DECOMPRESS_STATE_DONE;
+}
+
+#endif /* FWU_COMPRESSED_UPDATE */
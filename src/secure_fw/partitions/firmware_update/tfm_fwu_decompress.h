@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TFM_FWU_DECOMPRESS_H__
+#define __TFM_FWU_DECOMPRESS_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config_tfm.h"
+#include "psa/error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \file tfm_fwu_decompress.h
+ *
+ * \brief Streaming decompressor of compressed images
+ *
+ * A compressed image starts with a header:
+ *
+ *   - magic, \ref FWU_DECOMPRESS_MAGIC, 4 bytes little endian
+ *   - window size W in bits, 1 byte
+ *   - lookahead size L in bits, 1 byte
+ *   - reserved, 2 bytes of zero
+ *   - size of the decompressed image, 4 bytes little endian
+ *
+ * followed by a heatshrink stream, as produced by "heatshrink -e -w W -l L".
+ * The stream is a sequence of bits, read from the most significant bit of
+ * each byte:
+ *
+ *   - 1, then 8 bits: a literal byte
+ *   - 0, then W bits i, then L bits n: repeat n + 1 bytes, starting i + 1
+ *     bytes back in the output
+ *
+ * The window held in RAM is 2^\ref FWU_COMPRESS_WINDOW_BITS bytes, so W
+ * cannot be larger than \ref FWU_COMPRESS_WINDOW_BITS.
+ *
+ * The stream can be given in blocks of any size. The decompressed image is
+ * produced in order, in blocks of \ref FWU_COMPRESS_BUF_SIZE bytes except for
+ * the last one.
+ */
+
+#define FWU_DECOMPRESS_MAGIC       0x5a4d4654u /* "TFMZ" */
+#define FWU_DECOMPRESS_HEADER_SIZE 12u
+
+#define FWU_DECOMPRESS_WINDOW_SIZE (1u << FWU_COMPRESS_WINDOW_BITS)
+
+#if (FWU_COMPRESS_WINDOW_BITS < 4) || (FWU_COMPRESS_WINDOW_BITS > 15)
+#error "FWU_COMPRESS_WINDOW_BITS must be between 4 and 15"
+#endif
+
+/**
+ * \brief Write the decompressed image
+ *
+ * \param[in] priv    Private data given to \ref fwu_decompress_start
+ * \param[in] offset  Offset in the decompressed image
+ * \param[in] buf     Data to write
+ * \param[in] len     Number of bytes to write
+ *
+ * \return PSA_SUCCESS on success, an error otherwise
+ */
+typedef psa_status_t (*fwu_decompress_write_t)(void *priv, size_t offset,
+                                               const void *buf, size_t len);
+
+/**
+ * \brief State of the decompressor. The structure is opaque for the caller.
+ */
+struct fwu_decompress_ctx_t {
+    fwu_decompress_write_t write;
+    void *priv;
+    size_t target_size;    /* Size of the decompressed image */
+    size_t flushed;        /* Bytes of the image already written */
+    uint32_t state;
+    uint32_t header_len;   /* Bytes of the header received */
+    uint8_t header[FWU_DECOMPRESS_HEADER_SIZE];
+    uint8_t window_bits;   /* W, from the header */
+    uint8_t lookahead_bits; /* L, from the header */
+    uint8_t bit_byte;      /* Input byte being read */
+    uint8_t bit_count;     /* Bits of bit_byte not read yet */
+    uint32_t bits_wanted;  /* Bits left to read into bits_acc */
+    uint32_t bits_acc;
+    uint32_t index;        /* Distance of the back-reference */
+    uint32_t count;        /* Bytes of the back-reference left to copy */
+    uint32_t head;         /* Next position in the window */
+    size_t out_len;        /* Bytes of the image in out_buf */
+    uint8_t window[FWU_DECOMPRESS_WINDOW_SIZE];
+    uint8_t out_buf[FWU_COMPRESS_BUF_SIZE] __attribute__((aligned(4)));
+};
+
+/**
+ * \brief Check whether a block is the start of a compressed image
+ *
+ * \param[in] block       First block of the image
+ * \param[in] block_size  Size of the block
+ *
+ * \return true if the block starts with \ref FWU_DECOMPRESS_MAGIC
+ */
+bool fwu_decompress_is_compressed(const void *block, size_t block_size);
+
+/**
+ * \brief Start decompressing an image
+ *
+ * \param[out] ctx    Decompressor state
+ * \param[in]  write  Function writing the decompressed image
+ * \param[in]  priv   Private data given to write
+ */
+void fwu_decompress_start(struct fwu_decompress_ctx_t *ctx,
+                          fwu_decompress_write_t write,
+                          void *priv);
+
+/**
+ * \brief Decompress the next block of the stream
+ *
+ * \param[in,out] ctx   Decompressor state
+ * \param[in]     data  Block of the stream
+ * \param[in]     len   Size of the block
+ *
+ * \return PSA_SUCCESS                 On success
+ *         PSA_ERROR_INVALID_ARGUMENT  The stream is malformed
+ *         PSA_ERROR_NOT_SUPPORTED     The window of the stream is too large
+ *         PSA_ERROR_BAD_STATE         A previous block failed
+ *         Any error returned by the write function
+ */
+psa_status_t fwu_decompress_update(struct fwu_decompress_ctx_t *ctx,
+                                   const uint8_t *data, size_t len);
+
+/**
+ * \brief Check whether the whole decompressed image has been written
+ *
+ * \param[in] ctx  Decompressor state
+ *
+ * \return true once the last byte of the image has been written
+ */
+bool fwu_decompress_is_complete(const struct fwu_decompress_ctx_t *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TFM_FWU_DECOMPRESS_H__ */
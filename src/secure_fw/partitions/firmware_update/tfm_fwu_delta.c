@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "config_tfm.h"
+
+#if FWU_DELTA_UPDATE
+
+#include "tfm_fwu_delta.h"
+
+enum fwu_delta_state_t {
+    FWU_DELTA_STATE_HEADER = 0,
+    FWU_DELTA_STATE_OPCODE,
+    FWU_DELTA_STATE_ARG,
+    FWU_DELTA_STATE_DATA,
+    FWU_DELTA_STATE_DONE,
+    FWU_DELTA_STATE_ERROR,
+};
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static size_t produced_size(const struct fwu_delta_ctx_t *ctx)
+{
+    return ctx->flushed + ctx->out_len;
+}
+
+static psa_status_t flush_output(struct fwu_delta_ctx_t *ctx)
+{
+    psa_status_t status;
+
+    if (ctx->out_len == 0) {
+        return PSA_SUCCESS;
+    }
+
+    status = ctx->write(ctx->priv, ctx->flushed, ctx->out_buf, ctx->out_len);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    ctx->flushed += ctx->out_len;
+    ctx->out_len = 0;
+
+    return PSA_SUCCESS;
+}
+
+/* Flush the output buffer once full, or once the new image is complete */
+static psa_status_t output_done(struct fwu_delta_ctx_t *ctx)
+{
+    if ((ctx->out_len == sizeof(ctx->out_buf)) ||
+        (produced_size(ctx) == ctx->target_size)) {
+        return flush_output(ctx);
+    }
+
+    return PSA_SUCCESS;
+}
+
+/* Append len bytes of the active image to the output buffer */
+static psa_status_t read_source(struct fwu_delta_ctx_t *ctx, size_t len)
+{
+    psa_status_t status;
+
+    status = ctx->read(ctx->priv, ctx->source_pos,
+                       ctx->out_buf + ctx->out_len, len);
+    if (status != PSA_SUCCESS) {
+        return status;
+    }
+
+    ctx->source_pos += len;
+
+    return PSA_SUCCESS;
+}
+
+static psa_status_t copy_source(struct fwu_delta_ctx_t *ctx, size_t len)
+{
+    psa_status_t status;
+    size_t chunk;
+
+    while (len > 0) {
+        chunk = sizeof(ctx->out_buf) - ctx->out_len;
+        if (chunk > len) {
+            chunk = len;
+        }
+
+        status = read_source(ctx, chunk);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+        ctx->out_len += chunk;
+        len -= chunk;
+
+        status = output_done(ctx);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+    }
+
+    return PSA_SUCCESS;
+}
+
+/* Start the operation whose argument has just been decoded */
+static psa_status_t start_operation(struct fwu_delta_ctx_t *ctx)
+{
+    size_t arg = ctx->arg;
+    size_t target_left = ctx->target_size - produced_size(ctx);
+    size_t source_left = ctx->source_size - ctx->source_pos;
+    psa_status_t status;
+
+    switch (ctx->op) {
+    case FWU_DELTA_OP_COPY:
+    case FWU_DELTA_OP_ADD:
+        if ((arg > target_left) || (arg > source_left)) {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        if (ctx->op == FWU_DELTA_OP_COPY) {
+            status = copy_source(ctx, arg);
+            if (status != PSA_SUCCESS) {
+                return status;
+            }
+            arg = 0;
+        }
+        break;
+    case FWU_DELTA_OP_INSERT:
+        if (arg > target_left) {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        break;
+    case FWU_DELTA_OP_SEEK:
+        /* Zigzag: even values are positive, odd values are negative */
+        if ((ctx->arg & 1u) == 0) {
+            if ((arg >> 1) > source_left) {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+            ctx->source_pos += arg >> 1;
+        } else {
+            if (((arg >> 1) + 1) > ctx->source_pos) {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+            ctx->source_pos -= (arg >> 1) + 1;
+        }
+        arg = 0;
+        break;
+    default:
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    ctx->remaining = arg;
+
+    return PSA_SUCCESS;
+}
+
+/* Consume the data bytes of an ADD or INSERT operation */
+static psa_status_t apply_data(struct fwu_delta_ctx_t *ctx,
+                               const uint8_t *data, size_t len)
+{
+    psa_status_t status;
+    uint8_t *out = ctx->out_buf + ctx->out_len;
+    size_t i;
+
+    if (ctx->op == FWU_DELTA_OP_ADD) {
+        status = read_source(ctx, len);
+        if (status != PSA_SUCCESS) {
+            return status;
+        }
+        for (i = 0; i < len; i++) {
+            out[i] = (uint8_t)(out[i] + data[i]);
+        }
+    } else {
+        (void)memcpy(out, data, len);
+    }
+
+    ctx->out_len += len;
+    ctx->remaining -= len;
+
+    return output_done(ctx);
+}
+
+bool fwu_delta_is_patch(const void *block, size_t block_size)
+{
+    if (block_size < FWU_DELTA_HEADER_SIZE) {
+        return false;
+    }
+
+    return get_le32((const uint8_t *)block) == FWU_DELTA_MAGIC;
+}
+
+void fwu_delta_start(struct fwu_delta_ctx_t *ctx,
+                     fwu_delta_read_t read,
+                     fwu_delta_write_t write,
+                     void *priv,
+                     size_t source_size)
+{
+    (void)memset(ctx, 0, sizeof(*ctx));
+
+    ctx->read = read;
+    ctx->write = write;
+    ctx->priv = priv;
+    ctx->source_size = source_size;
+    ctx->state = FWU_DELTA_STATE_HEADER;
+}
+
+static psa_status_t decode(struct fwu_delta_ctx_t *ctx,
+                           const uint8_t *data, size_t len)
+{
+    psa_status_t status;
+    size_t chunk;
+    uint8_t byte;
+
+    while (len > 0) {
+        switch (ctx->state) {
+        case FWU_DELTA_STATE_HEADER:
+            chunk = FWU_DELTA_HEADER_SIZE - ctx->header_len;
+            if (chunk > len) {
+                chunk = len;
+            }
+            (void)memcpy(&ctx->header[ctx->header_len], data, chunk);
+            ctx->header_len += chunk;
+            data += chunk;
+            len -= chunk;
+
+            if (ctx->header_len < FWU_DELTA_HEADER_SIZE) {
+                break;
+            }
+            if (get_le32(ctx->header) != FWU_DELTA_MAGIC) {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+            ctx->target_size = get_le32(&ctx->header[4]);
+            ctx->state = (ctx->target_size == 0) ? FWU_DELTA_STATE_DONE :
+                                                   FWU_DELTA_STATE_OPCODE;
+            break;
+
+        case FWU_DELTA_STATE_OPCODE:
+            ctx->op = *data++;
+            len--;
+            if (ctx->op > FWU_DELTA_OP_SEEK) {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+            ctx->arg = 0;
+            ctx->arg_shift = 0;
+            ctx->state = FWU_DELTA_STATE_ARG;
+            break;
+
+        case FWU_DELTA_STATE_ARG:
+            byte = *data++;
+            len--;
+            /* The argument fits in 32 bits, reject longer encodings */
+            if ((ctx->arg_shift == 28) && ((byte & 0xF0u) != 0)) {
+                return PSA_ERROR_INVALID_ARGUMENT;
+            }
+            ctx->arg |= (uint32_t)(byte & 0x7Fu) << ctx->arg_shift;
+            ctx->arg_shift += 7;
+            if ((byte & 0x80u) != 0) {
+                break;
+            }
+
+            status = start_operation(ctx);
+            if (status != PSA_SUCCESS) {
+                return status;
+            }
+            ctx->state = FWU_DELTA_STATE_DATA;
+            break;
+
+        case FWU_DELTA_STATE_DATA:
+            chunk = sizeof(ctx->out_buf) - ctx->out_len;
+            if (chunk > ctx->remaining) {
+                chunk = ctx->remaining;
+            }
+            if (chunk > len) {
+                chunk = len;
+            }
+
+            status = apply_data(ctx, data, chunk);
+            if (status != PSA_SUCCESS) {
+                return status;
+            }
+            data += chunk;
+            len -= chunk;
+            break;
+
+        default:
+            /* Trailing bytes after the last operation */
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+
+        if ((ctx->state == FWU_DELTA_STATE_DATA) && (ctx->remaining == 0)) {
+            ctx->state = (produced_size(ctx) == ctx->target_size) ?
+                         FWU_DELTA_STATE_DONE : FWU_DELTA_STATE_OPCODE;
+        }
+    }
+
+    return PSA_SUCCESS;
+}
+
+psa_status_t fwu_delta_update(struct fwu_delta_ctx_t *ctx,
+                              const uint8_t *data, size_t len)
+{
+    psa_status_t status;
+
+    if (ctx->state == FWU_DELTA_STATE_ERROR) {
+        return PSA_ERROR_BAD_STATE;
+    }
+
+    /* The decoder cannot resume from the middle of a failed block */
+    status = decode(ctx, data, len);
+    if (status != PSA_SUCCESS) {
+        ctx->state = FWU_DELTA_STATE_ERROR;
+    }
+
+    return status;
+}
+
+bool fwu_delta_is_complete(const struct fwu_delta_ctx_t *ctx)
+{
+    return ctx->state == FWU_DELTA_STATE_DONE;
+}
+
+#endif /* FWU_DELTA_UPDATE */
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TFM_FWU_DELTA_H__
+#define __TFM_FWU_DELTA_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config_tfm.h"
+#include "psa/error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \file tfm_fwu_delta.h
+ *
+ * \brief Streaming decoder of delta images
+ *
+ * A delta image rebuilds a new image from the active image and a patch. The
+ * patch starts with a header:
+ *
+ *   - magic, \ref FWU_DELTA_MAGIC, 4 bytes little endian
+ *   - size of the new image, 4 bytes little endian
+ *
+ * followed by a stream of operations. Each operation is an opcode byte and an
+ * argument, encoded as an unsigned LEB128 varint:
+ *
+ *   - \ref FWU_DELTA_OP_COPY n: copy n bytes of the active image
+ *   - \ref FWU_DELTA_OP_ADD n, followed by n bytes: add each byte, modulo 256,
+ *     to the next byte of the active image
+ *   - \ref FWU_DELTA_OP_INSERT n, followed by n bytes: insert the bytes
+ *   - \ref FWU_DELTA_OP_SEEK z: move the read position in the active image by
+ *     z bytes, a zigzag encoded signed value
+ *
+ * COPY and ADD read the active image from the read position, and move it
+ * forward. The patch ends once the new image has been produced.
+ *
+ * The patch can be given in blocks of any size. The new image is produced in
+ * order, in blocks of \ref FWU_DELTA_BUF_SIZE bytes except for the last one.
+ */
+
+#define FWU_DELTA_MAGIC       0x444d4654u /* "TFMD" */
+#define FWU_DELTA_HEADER_SIZE 8u
+
+#define FWU_DELTA_OP_COPY     0x00u
+#define FWU_DELTA_OP_ADD      0x01u
+#define FWU_DELTA_OP_INSERT   0x02u
+#define FWU_DELTA_OP_SEEK     0x03u
+
+/**
+ * \brief Read from the active image
+ *
+ * \param[in]  priv    Private data given to \ref fwu_delta_start
+ * \param[in]  offset  Offset in the active image
+ * \param[out] buf     Buffer to read into
+ * \param[in]  len     Number of bytes to read
+ *
+ * \return PSA_SUCCESS on success, an error otherwise
+ */
+typedef psa_status_t (*fwu_delta_read_t)(void *priv, size_t offset,
+                                         void *buf, size_t len);
+
+/**
+ * \brief Write to the new image
+ *
+ * \param[in] priv    Private data given to \ref fwu_delta_start
+ * \param[in] offset  Offset in the new image
+ * \param[in] buf     Data to write
+ * \param[in] len     Number of bytes to write
+ *
+ * \return PSA_SUCCESS on success, an error otherwise
+ */
+typedef psa_status_t (*fwu_delta_write_t)(void *priv, size_t offset,
+                                          const void *buf, size_t len);
+
+/**
+ * \brief State of the decoder. The structure is opaque for the caller.
+ */
+struct fwu_delta_ctx_t {
+    fwu_delta_read_t read;
+    fwu_delta_write_t write;
+    void *priv;
+    size_t source_size;    /* Size of the active image */
+    size_t target_size;    /* Size of the new image, from the header */
+    size_t source_pos;     /* Read position in the active image */
+    size_t flushed;        /* Bytes of the new image already written */
+    uint32_t state;
+    uint32_t header_len;   /* Bytes of the header received */
+    uint8_t header[FWU_DELTA_HEADER_SIZE];
+    uint8_t op;            /* Current operation */
+    uint32_t arg;          /* Argument of the operation being decoded */
+    uint32_t arg_shift;
+    size_t remaining;      /* Data bytes left in the current operation */
+    size_t out_len;        /* Bytes of the new image in out_buf */
+    uint8_t out_buf[FWU_DELTA_BUF_SIZE] __attribute__((aligned(4)));
+};
+
+/**
+ * \brief Check whether a block is the start of a delta image
+ *
+ * \param[in] block       First block of the image
+ * \param[in] block_size  Size of the block
+ *
+ * \return true if the block starts with \ref FWU_DELTA_MAGIC
+ */
+bool fwu_delta_is_patch(const void *block, size_t block_size);
+
+/**
+ * \brief Start decoding a delta image
+ *
+ * \param[out] ctx          Decoder state
+ * \param[in]  read         Function reading the active image
+ * \param[in]  write        Function writing the new image
+ * \param[in]  priv         Private data given to read and write
+ * \param[in]  source_size  Size of the active image
+ */
+void fwu_delta_start(struct fwu_delta_ctx_t *ctx,
+                     fwu_delta_read_t read,
+                     fwu_delta_write_t write,
+                     void *priv,
+                     size_t source_size);
+
+/**
+ * \brief Decode the next block of the patch
+ *
+ * \param[in,out] ctx   Decoder state
+ * \param[in]     data  Block of the patch
+ * \param[in]     len   Size of the block
+ *
+ * \return PSA_SUCCESS                 On success
+ *         PSA_ERROR_INVALID_ARGUMENT  The patch is malformed, or does not
+ *                                     apply to the active image
+ *         PSA_ERROR_BAD_STATE         A previous block failed
+ *         Any error returned by the read and write functions
+ */
+psa_status_t fwu_delta_update(struct fwu_delta_ctx_t *ctx,
+                              const uint8_t *data, size_t len);
+
+/**
+ * \brief Check whether the whole new image has been written
+ *
+ * \param[in] ctx  Decoder state
+ *
+ * \return true once the last operation of the patch has been decoded
+ */
+bool fwu_delta_is_complete(const struct fwu_delta_ctx_t *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TFM_FWU_DELTA_H__ */
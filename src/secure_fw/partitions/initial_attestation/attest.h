@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -11,6 +13,7 @@
 #include "psa/initial_attestation.h"
 #include "psa/client.h"
 #include "tfm_boot_status.h"
+#include "config_tfm.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -109,6 +112,42 @@ initial_attest_get_token(const void *challenge_buf, size_t challenge_size,
 psa_status_t
 initial_attest_get_token_size(size_t challenge_size, size_t *token_size);
 
+#if ATTEST_BATCH_MAX_CHALLENGES > 0
+/**
+ * \brief Start a batch of initial attestation tokens, and sign it
+ *
+ * \param[in] challenges       Buffer holding the challenges one after the
+ *                             other. It must stay valid until the last
+ *                             token of the batch is created.
+ * \param[in] challenge_size   Size of each challenge
+ * \param[in] challenge_count  Number of challenges in the batch
+ * \param[in] scratch_buf      Buffer where the payloads are encoded while
+ *                             hashing them, e.g. the token buffer
+ * \param[in] scratch_buf_size Size of scratch_buf
+ *
+ * \return Returns error code as specified in \ref psa_status_t
+ */
+psa_status_t
+initial_attest_batch_start(const uint8_t *challenges, size_t challenge_size,
+                           size_t challenge_count,
+                           void *scratch_buf, size_t scratch_buf_size);
+
+/**
+ * \brief Get a token of the batch started by initial_attest_batch_start()
+ *
+ * \param[in]  index           Index of the challenge in the batch
+ * \param[out] token_buf       Buffer where the token is written
+ * \param[in]  token_buf_size  Size of token_buf
+ * \param[out] token_size      Size of the token
+ *
+ * \return Returns error code as specified in \ref psa_status_t
+ */
+psa_status_t
+initial_attest_batch_get_token(size_t index,
+                               void *token_buf, size_t token_buf_size,
+                               size_t *token_size);
+#endif /* ATTEST_BATCH_MAX_CHALLENGES > 0 */
+
 #ifdef __cplusplus
 }
 #endif
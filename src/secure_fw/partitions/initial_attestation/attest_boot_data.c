@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -47,6 +49,27 @@ struct attest_boot_data {
  */
 __attribute__ ((aligned(4)))
 static struct attest_boot_data boot_data;
+
+/*!
+ * \struct attest_boot_data_module
+ *
+ * \brief Location of the first TLV entry of a SW module in \ref boot_data
+ */
+struct attest_boot_data_module {
+    uint16_t offset; /* Offset of the entry value in boot_data.data */
+    uint16_t len;    /* Length of the entry value */
+    uint8_t  claim;  /* Type of SW module's attribute */
+    bool     found;
+};
+
+/*!
+ * \var boot_data_index
+ *
+ * \brief Index of \ref boot_data by SW module, built once at init so that the
+ *        SW components claim does not need to scan the TLV section for each
+ *        module.
+ */
+static struct attest_boot_data_module boot_data_index[SW_MAX];
 #endif
 
 #ifdef TFM_PARTITION_MEASURED_BOOT
@@ -144,66 +167,42 @@ attest_encode_sw_component(QCBOREncodeContext *encode_ctx,
 }
 #else
 /*!
- * \brief Static function to look up all entries in the shared data area
- *       (boot status) which belong to a specific module.
- *
- * \param[in]     module  The identifier of SW module to look up based on this
- * \param[out]    claim   The type of SW module's attribute
- * \param[out]    tlv_len Length of the shared data entry
- * \param[in/out] tlv_ptr Pointer to the shared data entry. If its value NULL as
- *                        input then it will starts the look up from the
- *                        beginning of the shared data section. If not NULL then
- *                        it continue look up from the next entry. It returns
- *                        the address of next found entry which belongs to
- *                        module.
- *
- * \retval    -1          Error, boot status is malformed
- * \retval     0          Entry not found
- * \retval     1          Entry found
+ * \brief Static function to index the shared data area (boot status) by SW
+ *        module. Only the first entry of each module is indexed.
  */
-static int32_t attest_get_tlv_by_module(uint8_t    module,
-                                        uint8_t   *claim,
-                                        uint16_t  *tlv_len,
-                                        uint8_t  **tlv_ptr)
+static void attest_index_boot_data(void)
 {
     struct shared_data_tlv_entry tlv_entry;
     uint8_t *tlv_end;
     uint8_t *tlv_curr;
+    uint8_t module;
+
+    (void)memset(boot_data_index, 0, sizeof(boot_data_index));
 
     if (boot_data.header.tlv_magic != SHARED_DATA_TLV_INFO_MAGIC) {
-        return -1;
+        return;
     }
 
-    /* Get the boundaries of TLV section where to lookup*/
+    /* Get the boundaries of TLV section */
     tlv_end = (uint8_t *)&boot_data + boot_data.header.tlv_tot_len;
-    if (*tlv_ptr == NULL) {
-        /* At first call set to the beginning of the TLV section */
-        tlv_curr = boot_data.data;
-    } else {
-        /* Any subsequent call set to the next TLV entry */
-        (void)memcpy(&tlv_entry, *tlv_ptr, SHARED_DATA_ENTRY_HEADER_SIZE);
-
-        tlv_curr  = (*tlv_ptr) + SHARED_DATA_ENTRY_HEADER_SIZE
-                    + tlv_entry.tlv_len;
-    }
+    tlv_curr = boot_data.data;
 
-    /* Iterates over the TLV section and returns the address and size of TLVs
-     * with requested module identifier
-     */
     while (tlv_curr < tlv_end) {
         /* Create local copy to avoid unaligned access */
         (void)memcpy(&tlv_entry, tlv_curr, SHARED_DATA_ENTRY_HEADER_SIZE);
-        if (GET_IAS_MODULE(tlv_entry.tlv_type) == module) {
-            *claim   = GET_IAS_CLAIM(tlv_entry.tlv_type);
-            *tlv_ptr = tlv_curr;
-            *tlv_len = tlv_entry.tlv_len;
-            return 1;
+
+        module = GET_IAS_MODULE(tlv_entry.tlv_type);
+        if ((module < SW_MAX) && !boot_data_index[module].found) {
+            boot_data_index[module].offset =
+                (uint16_t)(tlv_curr + SHARED_DATA_ENTRY_HEADER_SIZE -
+                           boot_data.data);
+            boot_data_index[module].len = tlv_entry.tlv_len;
+            boot_data_index[module].claim = GET_IAS_CLAIM(tlv_entry.tlv_type);
+            boot_data_index[module].found = true;
         }
 
         tlv_curr += (SHARED_DATA_ENTRY_HEADER_SIZE + tlv_entry.tlv_len);
     }
-
-    return 0;
 }
 #endif /* TFM_PARTITION_MEASURED_BOOT */
 
@@ -288,11 +287,8 @@ attest_encode_sw_components_array(QCBOREncodeContext *encode_ctx,
 
 #else /* TFM_PARTITION_MEASURED_BOOT */
     struct q_useful_buf_c encoded_const = NULL_Q_USEFUL_BUF_C;
-    uint16_t tlv_len;
-    uint8_t *tlv_ptr;
-    uint8_t  tlv_id;
+    const struct attest_boot_data_module *entry;
     uint8_t module = 0;
-    int32_t found;
 
     if ((encode_ctx == NULL) || (cnt == NULL)) {
         return PSA_ATTEST_ERR_INVALID_INPUT;
@@ -303,19 +299,15 @@ attest_encode_sw_components_array(QCBOREncodeContext *encode_ctx,
     /* Extract all boot records (measurements) from the boot status information
      * that was received from the secure bootloader.
      */
+    if (boot_data.header.tlv_magic != SHARED_DATA_TLV_INFO_MAGIC) {
+        /* Boot status area is malformed. */
+        return PSA_ATTEST_ERR_CLAIM_UNAVAILABLE;
+    }
+
     for (module = 0; module < SW_MAX; ++module) {
-        /* Indicates to restart the look up from the beginning of the shared
-         * data section.
-         */
-        tlv_ptr = NULL;
-
-        /* Look up the first TLV entry which belongs to the SW module */
-        found = attest_get_tlv_by_module(module, &tlv_id,
-                                         &tlv_len, &tlv_ptr);
-        if (found == -1) {
-            /* Boot status area is malformed. */
-            return PSA_ATTEST_ERR_CLAIM_UNAVAILABLE;
-        } else if ((found == 1) && (tlv_id == SW_BOOT_RECORD)) {
+        /* The first TLV entry which belongs to the SW module */
+        entry = &boot_data_index[module];
+        if (entry->found && (entry->claim == SW_BOOT_RECORD)) {
             (*cnt)++;
             if (*cnt == 1) {
                 /* Open array which stores SW components claims. */
@@ -326,8 +318,8 @@ attest_encode_sw_components_array(QCBOREncodeContext *encode_ctx,
                 }
             }
 
-            encoded_const.ptr = tlv_ptr + SHARED_DATA_ENTRY_HEADER_SIZE;
-            encoded_const.len = tlv_len;
+            encoded_const.ptr = &boot_data.data[entry->offset];
+            encoded_const.len = entry->len;
             QCBOREncode_AddEncoded(encode_ctx, encoded_const);
         }
     }
@@ -351,10 +343,19 @@ enum psa_attest_err_t attest_boot_data_init(void)
      */
     return PSA_ATTEST_ERR_SUCCESS;
 #else
+    enum psa_attest_err_t err;
+
     TFM_COVERITY_DEVIATE_BLOCK(MISRA_C_2023_Rule_11_3, "Intentional pointer type conversion, tfm_boot_data and tfm_boot_data have similar structure");
-    return attest_get_boot_data(TLV_MAJOR_IAS,
-                                (struct tfm_boot_data *)&boot_data,
-                                MAX_BOOT_STATUS);
+    err = attest_get_boot_data(TLV_MAJOR_IAS,
+                               (struct tfm_boot_data *)&boot_data,
+                               MAX_BOOT_STATUS);
     TFM_COVERITY_BLOCK_END(MISRA_C_2023_Rule_11_3)
+    if (err != PSA_ATTEST_ERR_SUCCESS) {
+        return err;
+    }
+
+    attest_index_boot_data();
+
+    return PSA_ATTEST_ERR_SUCCESS;
 #endif
 }
@@ -1,10 +1,13 @@
 /*
  * Copyright (c) 2018-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include <stddef.h>
@@ -530,11 +533,19 @@ static void attest_get_option_flags(struct q_useful_buf_c *challenge,
 static enum psa_attest_err_t attest_get_t_cose_algorithm(
         int32_t *cose_algorithm_id)
 {
+    /* The IAK is a builtin key, its algorithm only needs to be looked up once */
+    static int32_t iak_cose_algorithm_id;
+    static bool iak_cose_algorithm_id_valid;
     psa_status_t status;
     psa_key_attributes_t attr;
     psa_key_handle_t handle = TFM_BUILTIN_KEY_ID_IAK;
     psa_key_type_t key_type;
 
+    if (iak_cose_algorithm_id_valid) {
+        *cose_algorithm_id = iak_cose_algorithm_id;
+        return PSA_ATTEST_ERR_SUCCESS;
+    }
+
     status = psa_get_key_attributes(handle, &attr);
     if (status != PSA_SUCCESS) {
         return PSA_ATTEST_ERR_GENERAL;
@@ -579,41 +590,365 @@ static enum psa_attest_err_t attest_get_t_cose_algorithm(
         return PSA_ATTEST_ERR_GENERAL;
     }
 
+    iak_cose_algorithm_id = *cose_algorithm_id;
+    iak_cose_algorithm_id_valid = true;
+
     return PSA_ATTEST_ERR_SUCCESS;
 }
 
+/*!
+ * \struct attest_claim_t
+ *
+ * \brief A claim of the token, with the function adding it to the token and
+ *        whether its value is the same in all the tokens of a given security
+ *        lifecycle state, so that it can be served from the claim cache.
+ */
+struct attest_claim_t {
+    enum psa_attest_err_t (*add)(struct attest_token_encode_ctx *);
+    bool is_static;
+};
+
+/* The SW components can be extended at runtime through Measured Boot */
+#ifdef TFM_PARTITION_MEASURED_BOOT
+#define ATTEST_SW_COMPONENTS_STATIC false
+#else
+#define ATTEST_SW_COMPONENTS_STATIC true
+#endif
+
 #if ATTEST_TOKEN_PROFILE_PSA_2_0_0
-    static enum psa_attest_err_t
-    (*claim_query_funcs[])(struct attest_token_encode_ctx *) = {
-        &attest_add_boot_seed_claim,
-        &attest_add_instance_id_claim,
-        &attest_add_implementation_id_claim,
-        &attest_add_caller_id_claim,
-        &attest_add_security_lifecycle_claim,
-        &attest_add_all_sw_components,
-        &attest_add_profile_definition,
+static const struct attest_claim_t claims[] = {
+    {&attest_add_boot_seed_claim,          true},
+    {&attest_add_instance_id_claim,        true},
+    {&attest_add_implementation_id_claim,  true},
+    {&attest_add_caller_id_claim,          false},
+    {&attest_add_security_lifecycle_claim, true},
+    {&attest_add_all_sw_components,        ATTEST_SW_COMPONENTS_STATIC},
+    {&attest_add_profile_definition,       true},
 #if ATTEST_INCLUDE_OPTIONAL_CLAIMS
-        &attest_add_verification_service,
-        &attest_add_cert_ref_claim
+    {&attest_add_verification_service,     true},
+    {&attest_add_cert_ref_claim,           true},
 #endif
-    };
+};
 #elif ATTEST_TOKEN_PROFILE_ARM_CCA
-
-    static enum psa_attest_err_t
-    (*claim_query_funcs[])(struct attest_token_encode_ctx *) = {
-        &attest_add_instance_id_claim,
-        &attest_add_implementation_id_claim,
-        &attest_add_security_lifecycle_claim,
-        &attest_add_all_sw_components,
-        &attest_add_profile_definition,
-        &attest_add_hash_algo_claim,
-        &attest_add_platform_config_claim,
+static const struct attest_claim_t claims[] = {
+    {&attest_add_instance_id_claim,        true},
+    {&attest_add_implementation_id_claim,  true},
+    {&attest_add_security_lifecycle_claim, true},
+    {&attest_add_all_sw_components,        ATTEST_SW_COMPONENTS_STATIC},
+    {&attest_add_profile_definition,       true},
+    {&attest_add_hash_algo_claim,          true},
+    {&attest_add_platform_config_claim,    true},
 #if ATTEST_INCLUDE_OPTIONAL_CLAIMS
-        &attest_add_verification_service,
+    {&attest_add_verification_service,     true},
 #endif
-    };
+};
 #endif /* ATTEST_TOKEN_PROFILE_PSA_2_0_0 */
 
+#if ATTEST_CLAIM_CACHE_SIZE > 0
+/*!
+ * \struct attest_claim_cache_entry_t
+ *
+ * \brief The CBOR encoded label and value of a static claim.
+ */
+struct attest_claim_cache_entry_t {
+    struct q_useful_buf_c label;
+    struct q_useful_buf_c value;
+};
+
+/* CBOR initial byte fields, RFC 8949 section 3 */
+#define ATTEST_CBOR_MAJOR_TYPE(ib)      ((ib) >> 5)
+#define ATTEST_CBOR_ADDITIONAL_INFO(ib) ((ib) & 0x1F)
+#define ATTEST_CBOR_MAJOR_UINT          0
+#define ATTEST_CBOR_MAJOR_NINT          1
+#define ATTEST_CBOR_MAP_OF_ONE_PAIR     0xA1
+
+/*!
+ * \struct attest_token_size_cache_entry_t
+ *
+ * \brief Size of the token last computed for a given challenge size. The size
+ *        also depends on the caller ID, which is encoded in the token.
+ */
+struct attest_token_size_cache_entry_t {
+    int32_t caller_id;
+    size_t token_size;
+    bool valid;
+};
+
+/* One entry per accepted challenge size, 32, 48 and 64 bytes */
+#define ATTEST_TOKEN_SIZE_CACHE_ENTRIES 3
+#define ATTEST_TOKEN_SIZE_CACHE_INDEX(challenge_size) \
+    (((challenge_size) - PSA_INITIAL_ATTEST_CHALLENGE_SIZE_32) / 16)
+
+static uint8_t claim_cache_buf[ATTEST_CLAIM_CACHE_SIZE];
+static struct attest_claim_cache_entry_t claim_cache[ARRAY_LENGTH(claims)];
+static enum tfm_security_lifecycle_t claim_cache_lifecycle;
+static bool claim_cache_valid;
+static struct attest_token_size_cache_entry_t
+    token_size_cache[ATTEST_TOKEN_SIZE_CACHE_ENTRIES];
+
+/*!
+ * \brief Static function to get the size of the head of a CBOR integer, i.e.
+ *        the size of the complete encoded integer.
+ *
+ * \param[in]  initial_byte  First byte of the encoded integer
+ *
+ * \return Returns the size in bytes, or 0 if the item is not an integer
+ */
+static size_t attest_cbor_int_size(uint8_t initial_byte)
+{
+    uint8_t major_type = ATTEST_CBOR_MAJOR_TYPE(initial_byte);
+    uint8_t additional_info = ATTEST_CBOR_ADDITIONAL_INFO(initial_byte);
+
+    if ((major_type != ATTEST_CBOR_MAJOR_UINT) &&
+        (major_type != ATTEST_CBOR_MAJOR_NINT)) {
+        return 0;
+    }
+
+    /* Values below 24 are encoded in the initial byte itself, 24 to 27 are
+     * followed by a 1, 2, 4 or 8 bytes argument.
+     */
+    switch (additional_info) {
+    case 24:
+        return 2;
+    case 25:
+        return 3;
+    case 26:
+        return 5;
+    case 27:
+        return 9;
+    default:
+        return (additional_info < 24) ? 1 : 0;
+    }
+}
+
+/*!
+ * \brief Static function to encode all the static claims into the claim
+ *        cache.
+ *
+ * Each claim is encoded on its own as a single entry map, then split into its
+ * label and value, so that both can be added to the token as pre-encoded
+ * items.
+ *
+ * \return Returns error code as specified in \ref psa_attest_err_t
+ */
+static enum psa_attest_err_t attest_claim_cache_build(void)
+{
+    struct attest_token_encode_ctx claim_ctx;
+    struct q_useful_buf free_buf;
+    struct q_useful_buf_c encoded;
+    enum psa_attest_err_t attest_err;
+    size_t used = 0;
+    size_t label_size;
+    size_t i;
+
+    claim_cache_valid = false;
+    claim_cache_lifecycle = tfm_attest_hal_get_security_lifecycle();
+    (void)memset(token_size_cache, 0, sizeof(token_size_cache));
+
+    for (i = 0; i < ARRAY_LENGTH(claims); ++i) {
+        if (!claims[i].is_static) {
+            continue;
+        }
+
+        free_buf.ptr = &claim_cache_buf[used];
+        free_buf.len = sizeof(claim_cache_buf) - used;
+
+        QCBOREncode_Init(&claim_ctx.cbor_enc_ctx, free_buf);
+        QCBOREncode_OpenMap(&claim_ctx.cbor_enc_ctx);
+        attest_err = claims[i].add(&claim_ctx);
+        if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
+            return attest_err;
+        }
+        QCBOREncode_CloseMap(&claim_ctx.cbor_enc_ctx);
+
+        if (QCBOREncode_Finish(&claim_ctx.cbor_enc_ctx, &encoded) !=
+            QCBOR_SUCCESS) {
+            return PSA_ATTEST_ERR_BUFFER_OVERFLOW;
+        }
+
+        /* A map holding exactly one label and value pair */
+        if ((encoded.len < 3) ||
+            (((const uint8_t *)encoded.ptr)[0] != ATTEST_CBOR_MAP_OF_ONE_PAIR)) {
+            return PSA_ATTEST_ERR_GENERAL;
+        }
+
+        label_size = attest_cbor_int_size(((const uint8_t *)encoded.ptr)[1]);
+        if ((label_size == 0) || (label_size >= (encoded.len - 1))) {
+            return PSA_ATTEST_ERR_GENERAL;
+        }
+
+        claim_cache[i].label.ptr = (const uint8_t *)encoded.ptr + 1;
+        claim_cache[i].label.len = label_size;
+        claim_cache[i].value.ptr = (const uint8_t *)encoded.ptr + 1 + label_size;
+        claim_cache[i].value.len = encoded.len - 1 - label_size;
+
+        used += encoded.len;
+    }
+
+    claim_cache_valid = true;
+
+    return PSA_ATTEST_ERR_SUCCESS;
+}
+
+/*!
+ * \brief Static function to check that the claim cache is up to date, and to
+ *        (re)build it if not.
+ *
+ * \return Returns true if the claim cache can be used
+ */
+static bool attest_claim_cache_refresh(void)
+{
+    if (claim_cache_valid &&
+        (tfm_attest_hal_get_security_lifecycle() == claim_cache_lifecycle)) {
+        return true;
+    }
+
+    if (attest_claim_cache_build() != PSA_ATTEST_ERR_SUCCESS) {
+        /* Fall back to encoding each claim in the token */
+        LOG_DBGFMT("Attestation: claim cache disabled, increase ATTEST_CLAIM_CACHE_SIZE\r\n");
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Static function to add a static claim to the attestation token from
+ *        the claim cache.
+ *
+ * \param[in]  token_ctx  Token encoding context
+ * \param[in]  entry      Cache entry of the claim
+ */
+static void
+attest_add_cached_claim(struct attest_token_encode_ctx *token_ctx,
+                        const struct attest_claim_cache_entry_t *entry)
+{
+    QCBOREncodeContext *cbor_encode_ctx;
+
+    cbor_encode_ctx = attest_token_encode_borrow_cbor_cntxt(token_ctx);
+
+    /* Label and value are added as two items, as expected within a map */
+    QCBOREncode_AddEncoded(cbor_encode_ctx, entry->label);
+    QCBOREncode_AddEncoded(cbor_encode_ctx, entry->value);
+}
+
+/*!
+ * \brief Static function to get the caller ID the token size depends on.
+ *
+ * \return Returns the caller ID, or 0 if it is not part of the token
+ */
+static int32_t attest_token_size_cache_caller_id(void)
+{
+    int32_t caller_id = 0;
+
+#if ATTEST_TOKEN_PROFILE_PSA_2_0_0
+    if (attest_get_caller_client_id(&caller_id) != PSA_ATTEST_ERR_SUCCESS) {
+        caller_id = 0;
+    }
+#endif
+
+    return caller_id;
+}
+
+/*!
+ * \brief Static function to look up the token size for a challenge size.
+ *
+ * The token size only changes with the claims, so it is valid as long as the
+ * claim cache is. Tokens including the SW components from Measured Boot are
+ * never looked up, as measurements can be added at runtime.
+ *
+ * \param[in]  challenge_size  Size of the challenge, already verified
+ * \param[out] token_size      Size of the token
+ *
+ * \return Returns true if the size was found
+ */
+static bool attest_token_size_cache_lookup(size_t challenge_size,
+                                           size_t *token_size)
+{
+    const struct attest_token_size_cache_entry_t *entry =
+        &token_size_cache[ATTEST_TOKEN_SIZE_CACHE_INDEX(challenge_size)];
+
+    if (!ATTEST_SW_COMPONENTS_STATIC || !attest_claim_cache_refresh()) {
+        return false;
+    }
+
+    if (!entry->valid ||
+        (entry->caller_id != attest_token_size_cache_caller_id())) {
+        return false;
+    }
+
+    *token_size = entry->token_size;
+
+    return true;
+}
+
+static void attest_token_size_cache_store(size_t challenge_size,
+                                          size_t token_size)
+{
+    struct attest_token_size_cache_entry_t *entry =
+        &token_size_cache[ATTEST_TOKEN_SIZE_CACHE_INDEX(challenge_size)];
+
+    if (!ATTEST_SW_COMPONENTS_STATIC || !claim_cache_valid) {
+        return;
+    }
+
+    entry->caller_id = attest_token_size_cache_caller_id();
+    entry->token_size = token_size;
+    entry->valid = true;
+}
+#endif /* ATTEST_CLAIM_CACHE_SIZE > 0 */
+
+/*!
+ * \brief Static function to add the nonce and all the claims to the payload
+ *        of the token.
+ *
+ * \param[in]  token_ctx     Token encoding context
+ * \param[in]  challenge     Structure to carry the challenge value:
+ *                           pointer + challeng's length
+ * \param[in]  option_flags  Flags to select different custom options
+ *
+ * \return Returns error code as specified in \ref psa_attest_err_t
+ */
+static enum psa_attest_err_t
+attest_add_all_claims(struct attest_token_encode_ctx *token_ctx,
+                      const struct q_useful_buf_c *challenge,
+                      uint32_t option_flags)
+{
+    enum psa_attest_err_t attest_err;
+    int i;
+#if ATTEST_CLAIM_CACHE_SIZE > 0
+    bool use_cache = false;
+#endif
+
+    attest_err = attest_add_nonce_claim(token_ctx, challenge);
+    if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
+        return attest_err;
+    }
+
+    if (option_flags & TOKEN_OPT_OMIT_CLAIMS) {
+        return PSA_ATTEST_ERR_SUCCESS;
+    }
+
+#if ATTEST_CLAIM_CACHE_SIZE > 0
+    use_cache = attest_claim_cache_refresh();
+#endif
+    for (i = 0; i < ARRAY_LENGTH(claims); ++i) {
+#if ATTEST_CLAIM_CACHE_SIZE > 0
+        if (use_cache && claims[i].is_static) {
+            attest_add_cached_claim(token_ctx, &claim_cache[i]);
+            continue;
+        }
+#endif
+        /* Calling the attest_add_XXX_claim functions */
+        attest_err = claims[i].add(token_ctx);
+        if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
+            return attest_err;
+        }
+    }
+
+    return PSA_ATTEST_ERR_SUCCESS;
+}
+
 /*!
  * \brief Static function to create the initial attestation token
  *
@@ -636,7 +971,6 @@ attest_create_token(struct q_useful_buf_c *challenge,
     struct attest_token_encode_ctx attest_token_ctx;
     int32_t key_select = 0;
     uint32_t option_flags = 0;
-    int i;
     int32_t cose_algorithm_id;
 
     attest_err = attest_get_t_cose_algorithm(&cose_algorithm_id);
@@ -674,22 +1008,12 @@ attest_create_token(struct q_useful_buf_c *challenge,
         goto error;
     }
 
-    attest_err = attest_add_nonce_claim(&attest_token_ctx,
-                                        challenge);
+    attest_err = attest_add_all_claims(&attest_token_ctx, challenge,
+                                       option_flags);
     if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
         goto error;
     }
 
-    if (!(option_flags & TOKEN_OPT_OMIT_CLAIMS)) {
-        for (i = 0; i < ARRAY_LENGTH(claim_query_funcs); ++i) {
-            /* Calling the attest_add_XXX_claim functions */
-            attest_err = claim_query_funcs[i](&attest_token_ctx);
-            if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
-                goto error;
-            }
-        }
-    }
-
     /* Finish up creating the token. This is where the actual signature
      * is generated. This finishes up the CBOR encoding too.
      */
@@ -758,6 +1082,15 @@ initial_attest_get_token_size(const size_t challenge_size,
         goto error;
     }
 
+#if ATTEST_CLAIM_CACHE_SIZE > 0
+    if (attest_token_size_cache_lookup(challenge_size, token_size)) {
+        goto error;
+    }
+#endif
+
+    /* The token is only encoded to get its size, t_cose detects the NULL
+     * buffer and accounts for the signature size without signing.
+     */
     attest_err = attest_create_token(&challenge, &token, &completed_token);
     if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
         goto error;
@@ -765,6 +1098,151 @@ initial_attest_get_token_size(const size_t challenge_size,
 
     *token_size = completed_token.len;
 
+#if ATTEST_CLAIM_CACHE_SIZE > 0
+    attest_token_size_cache_store(challenge_size, completed_token.len);
+#endif
+
+error:
+    return error_mapping_to_psa_status_t(attest_err);
+}
+
+#if ATTEST_BATCH_MAX_CHALLENGES > 0
+/* The batch in progress, with the Merkle tree of its payloads */
+static struct attest_token_batch_ctx batch_ctx;
+static const uint8_t *batch_challenges;
+static size_t batch_challenge_size;
+static size_t batch_challenge_count;
+
+psa_status_t
+initial_attest_batch_start(const uint8_t *challenges, size_t challenge_size,
+                           size_t challenge_count,
+                           void *scratch_buf, size_t scratch_buf_size)
+{
+    enum psa_attest_err_t attest_err;
+    enum attest_token_err_t token_err;
+    struct attest_token_encode_ctx payload_ctx;
+    struct q_useful_buf scratch;
+    struct q_useful_buf_c challenge;
+    struct q_useful_buf_c payload;
+    int32_t cose_algorithm_id;
+    size_t i;
+
+    batch_challenges = NULL;
+
+    attest_err = attest_verify_challenge_size(challenge_size);
+    if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
+        goto error;
+    }
+
+    if ((challenge_count == 0) ||
+        (challenge_count > ATTEST_BATCH_MAX_CHALLENGES)) {
+        attest_err = PSA_ATTEST_ERR_INVALID_INPUT;
+        goto error;
+    }
+
+    attest_err = attest_get_t_cose_algorithm(&cose_algorithm_id);
+    if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
+        goto error;
+    }
+
+    token_err = attest_token_batch_start(&batch_ctx, cose_algorithm_id,
+                                         challenge_count);
+    if (token_err != ATTEST_TOKEN_ERR_SUCCESS) {
+        attest_err = error_mapping_to_psa_attest_err_t(token_err);
+        goto error;
+    }
+
+    scratch.ptr = scratch_buf;
+    scratch.len = scratch_buf_size;
+    challenge.len = challenge_size;
+
+    /* Only the payload of each token is encoded, to hash it into its leaf */
+    for (i = 0; i < challenge_count; i++) {
+        challenge.ptr = challenges + (i * challenge_size);
+
+        QCBOREncode_Init(&payload_ctx.cbor_enc_ctx, scratch);
+        QCBOREncode_OpenMap(&payload_ctx.cbor_enc_ctx);
+        attest_err = attest_add_all_claims(&payload_ctx, &challenge, 0);
+        if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
+            goto error;
+        }
+        QCBOREncode_CloseMap(&payload_ctx.cbor_enc_ctx);
+
+        if (QCBOREncode_Finish(&payload_ctx.cbor_enc_ctx, &payload) !=
+            QCBOR_SUCCESS) {
+            attest_err = PSA_ATTEST_ERR_BUFFER_OVERFLOW;
+            goto error;
+        }
+
+        token_err = attest_token_batch_add_leaf(&batch_ctx, i, &payload);
+        if (token_err != ATTEST_TOKEN_ERR_SUCCESS) {
+            attest_err = error_mapping_to_psa_attest_err_t(token_err);
+            goto error;
+        }
+    }
+
+    /* The single signature of the batch */
+    token_err = attest_token_batch_sign(&batch_ctx);
+    if (token_err != ATTEST_TOKEN_ERR_SUCCESS) {
+        attest_err = error_mapping_to_psa_attest_err_t(token_err);
+        goto error;
+    }
+
+    batch_challenges = challenges;
+    batch_challenge_size = challenge_size;
+    batch_challenge_count = challenge_count;
+
+error:
+    return error_mapping_to_psa_status_t(attest_err);
+}
+
+psa_status_t
+initial_attest_batch_get_token(size_t index,
+                               void *token_buf, size_t token_buf_size,
+                               size_t *token_size)
+{
+    enum psa_attest_err_t attest_err;
+    enum attest_token_err_t token_err;
+    struct attest_token_encode_ctx attest_token_ctx;
+    struct q_useful_buf token;
+    struct q_useful_buf_c challenge;
+    struct q_useful_buf_c completed_token;
+
+    if (batch_challenges == NULL) {
+        return PSA_ERROR_BAD_STATE;
+    }
+
+    if ((index >= batch_challenge_count) || (token_buf_size == 0)) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    token.ptr = token_buf;
+    token.len = token_buf_size;
+    challenge.ptr = batch_challenges + (index * batch_challenge_size);
+    challenge.len = batch_challenge_size;
+
+    token_err = attest_token_encode_start_batch(&attest_token_ctx, &batch_ctx,
+                                                index, &token);
+    if (token_err != ATTEST_TOKEN_ERR_SUCCESS) {
+        attest_err = error_mapping_to_psa_attest_err_t(token_err);
+        goto error;
+    }
+
+    attest_err = attest_add_all_claims(&attest_token_ctx, &challenge, 0);
+    if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
+        goto error;
+    }
+
+    token_err = attest_token_encode_finish_batch(&attest_token_ctx, &batch_ctx,
+                                                 index, &completed_token);
+    attest_err = error_mapping_to_psa_attest_err_t(token_err);
+    if (attest_err != PSA_ATTEST_ERR_SUCCESS) {
+        goto error;
+    }
+
+    *token_size = completed_token.len;
+
 error:
     return error_mapping_to_psa_status_t(attest_err);
 }
+#endif /* ATTEST_BATCH_MAX_CHALLENGES > 0 */
@@ -3,6 +3,8 @@
  *
  * Copyright (c) 2018-2019, Laurence Lundblade.
  * Copyright (c) 2020-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -12,7 +14,10 @@
 #ifndef __ATTEST_TOKEN_H__
 #define __ATTEST_TOKEN_H__
 
+#include <stddef.h>
 #include <stdint.h>
+#include "config_tfm.h"
+#include "psa/crypto.h"
 #include "qcbor/qcbor.h"
 #ifdef SYMMETRIC_INITIAL_ATTESTATION
 #include "t_cose_mac0_sign.h"
@@ -40,6 +45,9 @@ extern "C" {
  *
  *   -# Call attest_token_encode_finish() to create the signature and finish
  *   formatting the COSE signed output.
+ *
+ * The tokens of a batch share a single signature, see
+ * attest_token_batch_start().
  */
 
 /**
@@ -251,6 +259,148 @@ enum attest_token_err_t
 attest_token_encode_finish(struct attest_token_encode_ctx *me,
                            struct q_useful_buf_c *completed_token);
 
+#if ATTEST_BATCH_MAX_CHALLENGES > 0
+/**
+ * Size of the buffer for the protected header parameters of the tokens of a
+ * batch: a map of the algorithm ID and of the number of tokens.
+ */
+#define ATTEST_TOKEN_BATCH_MAX_SIZE_PROTECTED_PARAMETERS (1 + 1 + 5 + 5 + 9)
+
+/**
+ * Number of nodes of the Merkle tree of a batch. Every level is stored, and a
+ * node without sibling is copied to the level above, which costs at most one
+ * extra node per level.
+ */
+#ifdef SYMMETRIC_INITIAL_ATTESTATION
+#error "ATTEST_BATCH_MAX_CHALLENGES requires asymmetric initial attestation"
+#endif
+#if ATTEST_BATCH_MAX_CHALLENGES > 64
+#error "ATTEST_BATCH_MAX_CHALLENGES must not be larger than 64"
+#endif
+#define ATTEST_TOKEN_BATCH_MAX_NODES ((2 * ATTEST_BATCH_MAX_CHALLENGES) + 6)
+
+/**
+ * Size of the buffer for the signature of a batch, large enough for ES512.
+ */
+#define ATTEST_TOKEN_BATCH_MAX_SIG_SIZE (2 * 66)
+
+/**
+ * The context for signing a batch of tokens with a single signature.
+ *
+ * It holds the Merkle tree of the payloads of the tokens, level by level
+ * from the leaves to the root, and the signature computed over the root.
+ * It is too large for the stack, the caller is expected to keep it in
+ * static memory.
+ *
+ * The structure is opaque for the caller.
+ */
+struct attest_token_batch_ctx {
+    /* Private data structure */
+    int32_t               cose_alg_id;
+    psa_algorithm_t       hash_alg;
+    size_t                hash_len;
+    size_t                leaf_count;
+    size_t                node_count;
+    uint8_t               tree[ATTEST_TOKEN_BATCH_MAX_NODES][PSA_HASH_MAX_SIZE];
+    uint8_t               protected_buf[ATTEST_TOKEN_BATCH_MAX_SIZE_PROTECTED_PARAMETERS];
+    struct q_useful_buf_c protected_parameters;
+    uint8_t               signature_buf[ATTEST_TOKEN_BATCH_MAX_SIG_SIZE];
+    struct q_useful_buf_c signature;
+};
+
+/**
+ * \brief Initialize a batch signing context.
+ *
+ * \param[in] batch        The batch context to be initialized.
+ * \param[in] cose_alg_id  The algorithm to sign with, one of the ECDSA
+ *                         COSE algorithm IDs.
+ * \param[in] leaf_count   The number of tokens of the batch.
+ *
+ * \return one of the \ref attest_token_err_t errors.
+ *
+ * Creating the tokens of a batch goes as follows:
+ *
+ *   -# Encode the payload of each token, i.e. the claims map, and give it
+ *   to attest_token_batch_add_leaf().
+ *
+ *   -# Call attest_token_batch_sign() to compute the Merkle tree and sign
+ *   its root.
+ *
+ *   -# Create each token with attest_token_encode_start_batch(), the add
+ *   methods and attest_token_encode_finish_batch(). The payload must be
+ *   the same as the one given to attest_token_batch_add_leaf().
+ */
+enum attest_token_err_t
+attest_token_batch_start(struct attest_token_batch_ctx *batch,
+                         int32_t cose_alg_id,
+                         size_t leaf_count);
+
+/**
+ * \brief Add the payload of a token to the Merkle tree of the batch
+ *
+ * \param[in] batch    The batch context.
+ * \param[in] index    Index of the token in the batch.
+ * \param[in] payload  The encoded payload of the token.
+ *
+ * \return one of the \ref attest_token_err_t errors.
+ */
+enum attest_token_err_t
+attest_token_batch_add_leaf(struct attest_token_batch_ctx *batch,
+                            size_t index,
+                            const struct q_useful_buf_c *payload);
+
+/**
+ * \brief Compute the root of the Merkle tree and sign it
+ *
+ * \param[in] batch  The batch context, with all leaves added.
+ *
+ * \return one of the \ref attest_token_err_t errors.
+ *
+ * This is the only signing operation of the batch.
+ */
+enum attest_token_err_t
+attest_token_batch_sign(struct attest_token_batch_ctx *batch);
+
+/**
+ * \brief Initialize a token creation context for a token of a batch.
+ *
+ * \param[in] me          The token creation context to be initialized.
+ * \param[in] batch       The signed batch context.
+ * \param[in] index       Index of the token in the batch.
+ * \param[out] out_buffer The output buffer to write the encoded token into.
+ *
+ * \return one of the \ref attest_token_err_t errors.
+ *
+ * The inclusion proof of the token is added to the unprotected header
+ * parameters.
+ */
+enum attest_token_err_t
+attest_token_encode_start_batch(struct attest_token_encode_ctx *me,
+                                const struct attest_token_batch_ctx *batch,
+                                size_t index,
+                                const struct q_useful_buf *out_buffer);
+
+/**
+ * \brief Finish a token of a batch
+ *
+ * \param[in] me                Token Creation Context.
+ * \param[in] batch             The signed batch context.
+ * \param[in] index             Index of the token in the batch.
+ * \param[out] completed_token  Pointer and length to completed token.
+ *
+ * \return one of the \ref attest_token_err_t errors.
+ *
+ * No signing happens here, the signature of the batch is added. The payload
+ * is checked against the leaf of the token, so a claim which changed since
+ * attest_token_batch_add_leaf() is reported as an error.
+ */
+enum attest_token_err_t
+attest_token_encode_finish_batch(struct attest_token_encode_ctx *me,
+                                 const struct attest_token_batch_ctx *batch,
+                                 size_t index,
+                                 struct q_useful_buf_c *completed_token);
+#endif /* ATTEST_BATCH_MAX_CHALLENGES > 0 */
+
 #ifdef __cplusplus
 }
 #endif
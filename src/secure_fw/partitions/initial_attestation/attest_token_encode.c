@@ -3,6 +3,8 @@
  *
  * Copyright (c) 2018-2019, Laurence Lundblade. All rights reserved.
  * Copyright (c) 2020-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -22,6 +24,10 @@
 #include "psa/crypto.h"
 #include "attest_key.h"
 #include "tfm_crypto_defs.h"
+#if ATTEST_BATCH_MAX_CHALLENGES > 0
+#include <string.h>
+#include "psa/initial_attestation.h"
+#endif
 
 
 /**
@@ -317,6 +323,348 @@ attest_token_encode_finish(struct attest_token_encode_ctx *me,
 Done:
         return return_value;
 }
+
+#if ATTEST_BATCH_MAX_CHALLENGES > 0
+/*
+ * Outline of the creation of a batch of tokens.
+ *
+ * - Hash the payload of each token into a leaf of the Merkle tree
+ *   - leaf = H(0x00 || payload)
+ * - Hash each level of the tree into the level above, up to the root
+ *   - node = H(0x01 || left || right)
+ *   - A node without sibling is copied to the level above
+ * - Sign the root
+ *   - Encode the Sig_structure, with the root in place of the payload
+ *   - Hash the Sig_structure and run ECDSA
+ * - For each token
+ *   - Write COSE Headers
+ *     - Protected Header, the same for all tokens
+ *        - Algorithm ID
+ *        - Number of tokens in the batch
+ *     - Unprotected Headers
+ *       - Key ID
+ *       - Inclusion proof: index and sibling hashes from the leaf up
+ *   - Write the payload, check that it hashes to the leaf
+ *   - Write the signature of the batch
+ */
+
+/* Domain separation of the leaves and of the nodes of the tree */
+#define BATCH_LEAF_PREFIX 0x00u
+#define BATCH_NODE_PREFIX 0x01u
+
+/* COSE header parameters, see RFC 9052 */
+#define BATCH_COSE_HEADER_PARAM_ALG 1
+#define BATCH_COSE_HEADER_PARAM_KID 4
+
+/* Size of the Sig_structure: context string, protected header parameters,
+ * empty external AAD and root of the tree.
+ */
+#define BATCH_SIG_STRUCTURE_MAX_SIZE \
+    (1 + 11 + 2 + ATTEST_TOKEN_BATCH_MAX_SIZE_PROTECTED_PARAMETERS + 1 + \
+     2 + PSA_HASH_MAX_SIZE)
+
+static psa_algorithm_t batch_hash_alg(int32_t cose_alg_id)
+{
+    return cose_alg_id == T_COSE_ALGORITHM_ES256 ? PSA_ALG_SHA_256 :
+           cose_alg_id == T_COSE_ALGORITHM_ES384 ? PSA_ALG_SHA_384 :
+           cose_alg_id == T_COSE_ALGORITHM_ES512 ? PSA_ALG_SHA_512 :
+                                                   PSA_ALG_NONE;
+}
+
+/**
+ * \brief Hash a prefix byte followed by one or two inputs into a node.
+ */
+static enum attest_token_err_t
+batch_hash(const struct attest_token_batch_ctx *batch,
+           uint8_t prefix,
+           const uint8_t *first, size_t first_len,
+           const uint8_t *second, size_t second_len,
+           uint8_t *node)
+{
+    psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+    psa_status_t status;
+    size_t hash_len;
+
+    status = psa_hash_setup(&operation, batch->hash_alg);
+    if (status == PSA_SUCCESS) {
+        status = psa_hash_update(&operation, &prefix, sizeof(prefix));
+    }
+    if (status == PSA_SUCCESS) {
+        status = psa_hash_update(&operation, first, first_len);
+    }
+    if ((status == PSA_SUCCESS) && (second_len != 0)) {
+        status = psa_hash_update(&operation, second, second_len);
+    }
+    if (status == PSA_SUCCESS) {
+        status = psa_hash_finish(&operation, node, PSA_HASH_MAX_SIZE,
+                                 &hash_len);
+    }
+
+    if (status != PSA_SUCCESS) {
+        (void)psa_hash_abort(&operation);
+        return ATTEST_TOKEN_ERR_HASH_UNAVAILABLE;
+    }
+
+    return ATTEST_TOKEN_ERR_SUCCESS;
+}
+
+/*
+ * Public function. See attest_token.h
+ */
+enum attest_token_err_t
+attest_token_batch_start(struct attest_token_batch_ctx *batch,
+                         int32_t cose_alg_id,
+                         size_t leaf_count)
+{
+    QCBOREncodeContext cbor_enc_ctx;
+
+    if ((leaf_count == 0) || (leaf_count > ATTEST_BATCH_MAX_CHALLENGES)) {
+        return ATTEST_TOKEN_ERR_GENERAL;
+    }
+
+    batch->hash_alg = batch_hash_alg(cose_alg_id);
+    if (batch->hash_alg == PSA_ALG_NONE) {
+        return ATTEST_TOKEN_ERR_UNSUPPORTED_SIG_ALG;
+    }
+
+    batch->cose_alg_id = cose_alg_id;
+    batch->hash_len = PSA_HASH_LENGTH(batch->hash_alg);
+    batch->leaf_count = leaf_count;
+    batch->node_count = 0;
+    batch->signature = NULL_Q_USEFUL_BUF_C;
+
+    QCBOREncode_Init(&cbor_enc_ctx,
+                     Q_USEFUL_BUF_FROM_BYTE_ARRAY(batch->protected_buf));
+    QCBOREncode_OpenMap(&cbor_enc_ctx);
+    QCBOREncode_AddInt64ToMapN(&cbor_enc_ctx,
+                               BATCH_COSE_HEADER_PARAM_ALG,
+                               cose_alg_id);
+    QCBOREncode_AddUInt64ToMapN(&cbor_enc_ctx,
+                                TFM_ATTEST_BATCH_HEADER_LEAF_COUNT,
+                                leaf_count);
+    QCBOREncode_CloseMap(&cbor_enc_ctx);
+    if (QCBOREncode_Finish(&cbor_enc_ctx, &batch->protected_parameters) !=
+        QCBOR_SUCCESS) {
+        return ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    }
+
+    return ATTEST_TOKEN_ERR_SUCCESS;
+}
+
+/*
+ * Public function. See attest_token.h
+ */
+enum attest_token_err_t
+attest_token_batch_add_leaf(struct attest_token_batch_ctx *batch,
+                            size_t index,
+                            const struct q_useful_buf_c *payload)
+{
+    if (index >= batch->leaf_count) {
+        return ATTEST_TOKEN_ERR_GENERAL;
+    }
+
+    return batch_hash(batch, BATCH_LEAF_PREFIX,
+                      payload->ptr, payload->len, NULL, 0,
+                      batch->tree[index]);
+}
+
+/*
+ * Public function. See attest_token.h
+ */
+enum attest_token_err_t
+attest_token_batch_sign(struct attest_token_batch_ctx *batch)
+{
+    enum attest_token_err_t return_value;
+    QCBOREncodeContext cbor_enc_ctx;
+    uint8_t sig_structure_buf[BATCH_SIG_STRUCTURE_MAX_SIZE];
+    struct q_useful_buf_c sig_structure;
+    struct q_useful_buf_c root;
+    uint8_t tbs_hash[PSA_HASH_MAX_SIZE];
+    size_t tbs_hash_len;
+    size_t signature_len;
+    size_t level_offset = 0;
+    size_t level_len = batch->leaf_count;
+    size_t next = batch->leaf_count;
+    size_t i;
+    psa_status_t status;
+
+    /* Hash each level into the level above, which follows it in the tree */
+    while (level_len > 1) {
+        for (i = 0; i < level_len; i += 2) {
+            if ((i + 1) < level_len) {
+                return_value = batch_hash(batch, BATCH_NODE_PREFIX,
+                                          batch->tree[level_offset + i],
+                                          batch->hash_len,
+                                          batch->tree[level_offset + i + 1],
+                                          batch->hash_len,
+                                          batch->tree[next]);
+                if (return_value != ATTEST_TOKEN_ERR_SUCCESS) {
+                    return return_value;
+                }
+            } else {
+                (void)memcpy(batch->tree[next], batch->tree[level_offset + i],
+                             batch->hash_len);
+            }
+            next++;
+        }
+        level_offset += level_len;
+        level_len = (level_len + 1) / 2;
+    }
+    batch->node_count = next;
+
+    root.ptr = batch->tree[level_offset];
+    root.len = batch->hash_len;
+
+    /* Sig_structure of RFC 9052, the root stands for the payload */
+    QCBOREncode_Init(&cbor_enc_ctx,
+                     Q_USEFUL_BUF_FROM_BYTE_ARRAY(sig_structure_buf));
+    QCBOREncode_OpenArray(&cbor_enc_ctx);
+    QCBOREncode_AddSZString(&cbor_enc_ctx, "Signature1");
+    QCBOREncode_AddBytes(&cbor_enc_ctx, batch->protected_parameters);
+    QCBOREncode_AddBytes(&cbor_enc_ctx, NULL_Q_USEFUL_BUF_C);
+    QCBOREncode_AddBytes(&cbor_enc_ctx, root);
+    QCBOREncode_CloseArray(&cbor_enc_ctx);
+    if (QCBOREncode_Finish(&cbor_enc_ctx, &sig_structure) != QCBOR_SUCCESS) {
+        return ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    }
+
+    status = psa_hash_compute(batch->hash_alg,
+                              sig_structure.ptr, sig_structure.len,
+                              tbs_hash, sizeof(tbs_hash), &tbs_hash_len);
+    if (status != PSA_SUCCESS) {
+        return ATTEST_TOKEN_ERR_HASH_UNAVAILABLE;
+    }
+
+    status = psa_sign_hash(TFM_BUILTIN_KEY_ID_IAK,
+                           PSA_ALG_ECDSA(batch->hash_alg),
+                           tbs_hash, tbs_hash_len,
+                           batch->signature_buf, sizeof(batch->signature_buf),
+                           &signature_len);
+    if (status != PSA_SUCCESS) {
+        return ATTEST_TOKEN_ERR_SIGNING_KEY;
+    }
+
+    batch->signature.ptr = batch->signature_buf;
+    batch->signature.len = signature_len;
+
+    return ATTEST_TOKEN_ERR_SUCCESS;
+}
+
+/*
+ * Public function. See attest_token.h
+ */
+enum attest_token_err_t
+attest_token_encode_start_batch(struct attest_token_encode_ctx *me,
+                                const struct attest_token_batch_ctx *batch,
+                                size_t index,
+                                const struct q_useful_buf *out_buf)
+{
+    enum psa_attest_err_t attest_ret;
+    struct q_useful_buf_c attest_key_id = NULL_Q_USEFUL_BUF_C;
+    struct q_useful_buf_c sibling;
+    size_t level_offset = 0;
+    size_t level_len = batch->leaf_count;
+    size_t position = index;
+
+    if ((index >= batch->leaf_count) ||
+        q_useful_buf_c_is_null(batch->signature)) {
+        return ATTEST_TOKEN_ERR_GENERAL;
+    }
+
+    me->opt_flags  = 0;
+    me->key_select = 0;
+
+    attest_ret = attest_get_initial_attestation_key_id(&attest_key_id);
+    if (attest_ret != PSA_ATTEST_ERR_SUCCESS) {
+        return ATTEST_TOKEN_ERR_GENERAL;
+    }
+
+    QCBOREncode_Init(&(me->cbor_enc_ctx), *out_buf);
+
+    QCBOREncode_AddTag(&(me->cbor_enc_ctx), CBOR_TAG_COSE_SIGN1);
+    QCBOREncode_OpenArray(&(me->cbor_enc_ctx));
+    QCBOREncode_AddBytes(&(me->cbor_enc_ctx), batch->protected_parameters);
+
+    QCBOREncode_OpenMap(&(me->cbor_enc_ctx));
+    if (!q_useful_buf_c_is_null_or_empty(attest_key_id)) {
+        QCBOREncode_AddBytesToMapN(&(me->cbor_enc_ctx),
+                                   BATCH_COSE_HEADER_PARAM_KID,
+                                   attest_key_id);
+    }
+    QCBOREncode_OpenArrayInMapN(&(me->cbor_enc_ctx),
+                                TFM_ATTEST_BATCH_HEADER_PROOF);
+    QCBOREncode_AddUInt64(&(me->cbor_enc_ctx), index);
+    QCBOREncode_OpenArray(&(me->cbor_enc_ctx));
+    sibling.len = batch->hash_len;
+    while (level_len > 1) {
+        if ((position ^ 1u) < level_len) {
+            sibling.ptr = batch->tree[level_offset + (position ^ 1u)];
+            QCBOREncode_AddBytes(&(me->cbor_enc_ctx), sibling);
+        }
+        level_offset += level_len;
+        level_len = (level_len + 1) / 2;
+        position >>= 1;
+    }
+    QCBOREncode_CloseArray(&(me->cbor_enc_ctx));
+    QCBOREncode_CloseArray(&(me->cbor_enc_ctx));
+    QCBOREncode_CloseMap(&(me->cbor_enc_ctx));
+
+    QCBOREncode_BstrWrap(&(me->cbor_enc_ctx));
+    QCBOREncode_OpenMap(&(me->cbor_enc_ctx));
+
+    return ATTEST_TOKEN_ERR_SUCCESS;
+}
+
+/*
+ * Public function. See attest_token.h
+ */
+enum attest_token_err_t
+attest_token_encode_finish_batch(struct attest_token_encode_ctx *me,
+                                 const struct attest_token_batch_ctx *batch,
+                                 size_t index,
+                                 struct q_useful_buf_c *completed_token)
+{
+    enum attest_token_err_t return_value;
+    struct q_useful_buf_c   payload;
+    struct q_useful_buf_c   completed_token_ub;
+    uint8_t                 leaf[PSA_HASH_MAX_SIZE];
+    QCBORError              qcbor_result;
+
+    QCBOREncode_CloseMap(&(me->cbor_enc_ctx));
+    QCBOREncode_CloseBstrWrap2(&(me->cbor_enc_ctx), false, &payload);
+
+    qcbor_result = QCBOREncode_GetErrorState(&(me->cbor_enc_ctx));
+    if (qcbor_result == QCBOR_ERR_BUFFER_TOO_SMALL) {
+        return ATTEST_TOKEN_ERR_TOO_SMALL;
+    } else if (qcbor_result != QCBOR_SUCCESS) {
+        return ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    }
+
+    /* The signature only covers the payloads hashed into the tree */
+    return_value = batch_hash(batch, BATCH_LEAF_PREFIX,
+                              payload.ptr, payload.len, NULL, 0, leaf);
+    if (return_value != ATTEST_TOKEN_ERR_SUCCESS) {
+        return return_value;
+    }
+    if (memcmp(leaf, batch->tree[index], batch->hash_len) != 0) {
+        return ATTEST_TOKEN_ERR_GENERAL;
+    }
+
+    QCBOREncode_AddBytes(&(me->cbor_enc_ctx), batch->signature);
+    QCBOREncode_CloseArray(&(me->cbor_enc_ctx));
+
+    qcbor_result = QCBOREncode_Finish(&(me->cbor_enc_ctx), &completed_token_ub);
+    if (qcbor_result == QCBOR_ERR_BUFFER_TOO_SMALL) {
+        return ATTEST_TOKEN_ERR_TOO_SMALL;
+    } else if (qcbor_result != QCBOR_SUCCESS) {
+        return ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    }
+
+    *completed_token = completed_token_ub;
+
+    return ATTEST_TOKEN_ERR_SUCCESS;
+}
+#endif /* ATTEST_BATCH_MAX_CHALLENGES > 0 */
 #endif /* SYMMETRIC_INITIAL_ATTESTATION */
 
 /*
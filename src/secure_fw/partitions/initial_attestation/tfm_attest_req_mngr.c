@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Cypress Semiconductor Corporation (an Infineon company)
+ * Copyright (c) 2024-2025 Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
@@ -144,6 +144,105 @@ static psa_status_t psa_attest_get_token_size(const psa_msg_t *msg)
     return status;
 }
 
+#if ATTEST_BATCH_MAX_CHALLENGES > 0 && !PLATFORM_CREATES_ATTEST_TOKEN
+/* Challenges of the batch, kept until all of its tokens are created */
+static uint8_t batch_challenges[ATTEST_BATCH_MAX_CHALLENGES *
+                                PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64];
+
+static psa_status_t psa_attest_get_token_batch(const psa_msg_t *msg)
+{
+    psa_status_t status;
+    uint8_t *token_ptr;
+    size_t challenge_size;
+    size_t challenge_count;
+    size_t token_buff_size;
+    size_t token_size;
+    size_t written = 0;
+    size_t i;
+#if PSA_FRAMEWORK_HAS_MM_IOVEC != 1
+    size_t token_space;
+#endif
+
+    if (msg->in_size[0] != sizeof(challenge_size)) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (psa_read(msg->handle, 0, &challenge_size, sizeof(challenge_size))
+        != sizeof(challenge_size)) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (challenge_size == 0
+        || challenge_size > PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64
+        || (msg->in_size[1] % challenge_size) != 0) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    challenge_count = msg->in_size[1] / challenge_size;
+    token_buff_size = msg->out_size[0];
+
+    if (challenge_count == 0 || challenge_count > ATTEST_BATCH_MAX_CHALLENGES
+        || msg->out_size[1] != (challenge_count * sizeof(size_t))
+        || token_buff_size == 0) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    /* store the client ID here for later use in service */
+    g_attest_caller_id = msg->client_id;
+
+    if (psa_read(msg->handle, 1, batch_challenges, msg->in_size[1])
+        != msg->in_size[1]) {
+        return PSA_ERROR_GENERIC_ERROR;
+    }
+
+#if PSA_FRAMEWORK_HAS_MM_IOVEC == 1
+    /* The tokens are created in place, one after the other */
+    token_ptr = psa_map_outvec(msg->handle, 0);
+#else
+    /* Each token is created in token_buff, then written to the client */
+    token_ptr = token_buff;
+    if (token_buff_size > sizeof(token_buff)) {
+        token_buff_size = sizeof(token_buff);
+    }
+#endif
+
+    status = initial_attest_batch_start(batch_challenges, challenge_size,
+                                        challenge_count,
+                                        token_ptr, token_buff_size);
+
+    for (i = 0; (i < challenge_count) && (status == PSA_SUCCESS); i++) {
+#if PSA_FRAMEWORK_HAS_MM_IOVEC == 1
+        status = initial_attest_batch_get_token(i, token_ptr + written,
+                                                token_buff_size - written,
+                                                &token_size);
+#else
+        token_space = msg->out_size[0] - written;
+        if (token_space > token_buff_size) {
+            token_space = token_buff_size;
+        }
+
+        status = initial_attest_batch_get_token(i, token_ptr, token_space,
+                                                &token_size);
+        if (status == PSA_SUCCESS) {
+            psa_write(msg->handle, 0, token_ptr, token_size);
+        }
+#endif
+        if (status == PSA_SUCCESS) {
+            written += token_size;
+            psa_write(msg->handle, 1, &token_size, sizeof(token_size));
+        }
+    }
+
+#if PSA_FRAMEWORK_HAS_MM_IOVEC == 1
+    if (status == PSA_SUCCESS) {
+        psa_unmap_outvec(msg->handle, 0, written);
+    }
+#endif
+
+    return status;
+}
+#endif /* ATTEST_BATCH_MAX_CHALLENGES > 0 && !PLATFORM_CREATES_ATTEST_TOKEN */
+
 psa_status_t tfm_attestation_service_sfn(const psa_msg_t *msg)
 {
     switch (msg->type) {
@@ -151,6 +250,10 @@ psa_status_t tfm_attestation_service_sfn(const psa_msg_t *msg)
         return psa_attest_get_token(msg);
     case TFM_ATTEST_GET_TOKEN_SIZE:
         return psa_attest_get_token_size(msg);
+#if ATTEST_BATCH_MAX_CHALLENGES > 0 && !PLATFORM_CREATES_ATTEST_TOKEN
+    case TFM_ATTEST_GET_TOKEN_BATCH:
+        return psa_attest_get_token_batch(msg);
+#endif
     default:
         return PSA_ERROR_NOT_SUPPORTED;
     }
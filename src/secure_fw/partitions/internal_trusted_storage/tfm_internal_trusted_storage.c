@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2019-2023, Arm Limited. All rights reserved.
- * Copyright (c) 2022-2023 Cypress Semiconductor Corporation (an Infineon company)
+ * Copyright (c) 2022-2025 Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -22,6 +22,7 @@
 #include "flash_fs/its_flash_fs.h"
 #include "psa_manifest/pid.h"
 #include "tfm_its_defs.h"
+#include "tfm_perf_counters.h"
 #include "its_utils.h"
 #include "tfm_sp_log.h"
 
@@ -61,10 +62,60 @@ static uint8_t __ALIGNED(4) asset_data[ITS_UTILS_ALIGN(ITS_BUF_SIZE,
 #endif
 
 #ifdef TFM_PARTITION_INTERNAL_TRUSTED_STORAGE
+#if CONFIG_TFM_PERF_COUNTERS
+/* Count the operations of the ITS flash driver, whichever it is */
+static psa_status_t its_flash_counted_init(struct its_flash_config_t *cfg)
+{
+    return ITS_FLASH_OPS.init(cfg);
+}
+
+static psa_status_t its_flash_counted_read(const struct its_flash_config_t *cfg,
+                                           uint32_t block_id, uint8_t *buf,
+                                           size_t offset, size_t size)
+{
+    TFM_PERF_COUNTER_INC(TFM_PERF_ITS_FLASH_READS);
+    return ITS_FLASH_OPS.read(cfg, block_id, buf, offset, size);
+}
+
+static psa_status_t its_flash_counted_write(const struct its_flash_config_t *cfg,
+                                            uint32_t block_id,
+                                            const uint8_t *buf,
+                                            size_t offset, size_t size)
+{
+    TFM_PERF_COUNTER_INC(TFM_PERF_ITS_FLASH_PROGRAMS);
+    return ITS_FLASH_OPS.write(cfg, block_id, buf, offset, size);
+}
+
+static psa_status_t its_flash_counted_flush(const struct its_flash_config_t *cfg,
+                                            uint32_t block_id)
+{
+    return ITS_FLASH_OPS.flush(cfg, block_id);
+}
+
+static psa_status_t its_flash_counted_erase(const struct its_flash_config_t *cfg,
+                                            uint32_t block_id)
+{
+    TFM_PERF_COUNTER_INC(TFM_PERF_ITS_FLASH_ERASES);
+    return ITS_FLASH_OPS.erase(cfg, block_id);
+}
+
+static const struct its_flash_ops_t its_flash_counted_ops = {
+    .init = its_flash_counted_init,
+    .read = its_flash_counted_read,
+    .write = its_flash_counted_write,
+    .flush = its_flash_counted_flush,
+    .erase = its_flash_counted_erase,
+};
+#endif /* CONFIG_TFM_PERF_COUNTERS */
+
 static its_flash_fs_ctx_t fs_ctx_its;
 static struct its_flash_fs_config_t fs_cfg_its = {
     .flash_cfg = &fs_flash_config_its,
+#if CONFIG_TFM_PERF_COUNTERS
+    .ops = &its_flash_counted_ops,
+#else
     .ops = &ITS_FLASH_OPS,
+#endif
     .max_file_size = ITS_UTILS_ALIGN(ITS_MAX_ASSET_SIZE, ITS_FLASH_ALIGNMENT),
     .max_num_files = ITS_NUM_ASSETS + 1, /* Extra file for atomic replacement */
 };
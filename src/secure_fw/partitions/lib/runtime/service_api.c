@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2020-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -9,6 +11,7 @@
 #include "service_api.h"
 #include "psa/service.h"
 #include "svc_num.h"
+#include "tfm_perf_counters.h"
 #include "utilities.h"
 
 __attribute__((naked))
@@ -22,6 +25,27 @@ psa_status_t tfm_core_get_boot_data(uint8_t major_type,
         );
 }
 
+#if CONFIG_TFM_PERF_COUNTERS
+__attribute__((naked))
+psa_status_t tfm_perf_counter_update(uint32_t id, uint32_t op, uint32_t value)
+{
+    __ASM volatile(
+        "SVC    "M2S(TFM_SVC_PERF_COUNTER_UPDATE)"         \n"
+        "BX     lr                                         \n"
+        );
+}
+
+__attribute__((naked))
+psa_status_t tfm_perf_counters_read(struct tfm_perf_counters_t *counters,
+                                    uint32_t size)
+{
+    __ASM volatile(
+        "SVC    "M2S(TFM_SVC_PERF_COUNTERS_READ)"          \n"
+        "BX     lr                                         \n"
+        );
+}
+#endif /* CONFIG_TFM_PERF_COUNTERS */
+
 #if TFM_ISOLATION_LEVEL != 1
 /* Entry point when Partition FLIH functions return */
 __attribute__((naked))
@@ -20,6 +20,7 @@
 #include "psa/error.h"
 #include "utilities.h"
 #include "tfm_arch.h"
+#include "tfm_perf_counters.h"
 #include "thread.h"
 #include "tfm_psa_call_pack.h"
 #include "tfm_spe_mailbox.h"
@@ -54,10 +55,29 @@ struct vectors {
 static struct vectors vectors[NUM_MAILBOX_QUEUE_SLOT] = {0};
 
 
+#if CONFIG_TFM_PERF_COUNTERS
+/* Record the number of SPE queue slots in use */
+static void update_queue_depth_counter(void)
+{
+    mailbox_queue_status_t empty_slots = spe_mailbox_queue.empty_slots;
+    uint32_t depth = NUM_MAILBOX_QUEUE_SLOT;
+
+    while (empty_slots != 0) {
+        empty_slots &= empty_slots - 1;
+        depth--;
+    }
+
+    TFM_PERF_LEVEL_SET(TFM_PERF_MAILBOX_QUEUE, depth);
+}
+#else
+#define update_queue_depth_counter()
+#endif
+
 __STATIC_INLINE void set_spe_queue_empty_status(uint8_t idx)
 {
     if (idx < NUM_MAILBOX_QUEUE_SLOT) {
         spe_mailbox_queue.empty_slots |= (1 << idx);
+        update_queue_depth_counter();
     }
 }
 
@@ -65,6 +85,7 @@ __STATIC_INLINE void clear_spe_queue_empty_status(uint8_t idx)
 {
     if (idx < NUM_MAILBOX_QUEUE_SLOT) {
         spe_mailbox_queue.empty_slots &= ~(1 << idx);
+        update_queue_depth_counter();
     }
 }
 
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -8,6 +10,7 @@
 #include "config_tfm.h"
 #include "platform_sp.h"
 
+#include "tfm_perf_counters.h"
 #include "tfm_platform_system.h"
 #include "load/partition_defs.h"
 #include "psa_manifest/pid.h"
@@ -241,6 +244,27 @@ static psa_status_t platform_sp_ioctl_psa_api(const psa_msg_t *msg)
     return ret;
 }
 
+#if CONFIG_TFM_PERF_COUNTERS
+static psa_status_t platform_sp_perf_counters_psa_api(const psa_msg_t *msg)
+{
+    /* Too large for the stack of the partition */
+    static struct tfm_perf_counters_t counters;
+
+    if ((msg->in_size[0] != 0) ||
+        (msg->out_size[0] != sizeof(counters))) {
+        return TFM_PLATFORM_ERR_INVALID_PARAM;
+    }
+
+    if (tfm_perf_counters_read(&counters, sizeof(counters)) != PSA_SUCCESS) {
+        return TFM_PLATFORM_ERR_SYSTEM_ERROR;
+    }
+
+    psa_write(msg->handle, 0, &counters, sizeof(counters));
+
+    return TFM_PLATFORM_ERR_SUCCESS;
+}
+#endif /* CONFIG_TFM_PERF_COUNTERS */
+
 psa_status_t tfm_platform_service_sfn(const psa_msg_t *msg)
 {
     switch (msg->type) {
@@ -254,6 +278,10 @@ psa_status_t tfm_platform_service_sfn(const psa_msg_t *msg)
         return platform_sp_system_reset_psa_api(msg);
     case TFM_PLATFORM_API_ID_IOCTL:
         return platform_sp_ioctl_psa_api(msg);
+#if CONFIG_TFM_PERF_COUNTERS
+    case TFM_PLATFORM_API_ID_PERF_COUNTERS:
+        return platform_sp_perf_counters_psa_api(msg);
+#endif
     default:
         return PSA_ERROR_NOT_SUPPORTED;
     }
@@ -10,26 +10,70 @@
 #include "crt_impl_private.h"
 #include "static_checks.h"
 
+/*
+ * Merge the bytes of two consecutive aligned source words into a destination
+ * word, when the source is 'shift' bits after the first word.
+ */
+#ifdef __ARM_BIG_ENDIAN
+#define MERGE_WORDS(w0, w1, shift) (((w0) << (shift)) | ((w1) >> (32U - (shift))))
+#else
+#define MERGE_WORDS(w0, w1, shift) (((w0) >> (shift)) | ((w1) << (32U - (shift))))
+#endif
+
+/* The copy goes forward, memmove() relies on it for overlapping areas. */
 void *memcpy(void *dest, const void *src, size_t n)
 {
     union composite_addr_t p_dst, p_src;
+    uint32_t word, next, shift;
 
     TFM_COVERITY_DEVIATE_BLOCK(MISRA_C_2023_Rule_11_6, "Intentional pointer cast, addresses will fit into uintptr_t")
     p_dst.uint_addr = (uintptr_t)dest;
     p_src.uint_addr = (uintptr_t)src;
     TFM_COVERITY_BLOCK_END(MISRA_C_2023_Rule_11_6)
 
-    /* Byte copy for unaligned address. check the last bit of address. */
-    while (n && (ADDR_WORD_UNALIGNED(p_dst.uint_addr) ||
-                 ADDR_WORD_UNALIGNED(p_src.uint_addr))) {
+    /* Byte copy until the destination is aligned. */
+    while (n && ADDR_WORD_UNALIGNED(p_dst.uint_addr)) {
         *p_dst.p_byte++ = *p_src.p_byte++;
         n--;
     }
 
-    /* Quad byte copy for aligned address. */
-    while (n >= sizeof(uint32_t)) {
-        *(p_dst.p_word)++ = *(p_src.p_word)++;
-        n -= sizeof(uint32_t);
+    if (!ADDR_WORD_UNALIGNED(p_src.uint_addr)) {
+        /* Four words per iteration for aligned addresses. */
+        while (n >= 4 * sizeof(uint32_t)) {
+            p_dst.p_word[0] = p_src.p_word[0];
+            p_dst.p_word[1] = p_src.p_word[1];
+            p_dst.p_word[2] = p_src.p_word[2];
+            p_dst.p_word[3] = p_src.p_word[3];
+            p_dst.p_word += 4;
+            p_src.p_word += 4;
+            n -= 4 * sizeof(uint32_t);
+        }
+
+        /* Quad byte copy for the remaining words. */
+        while (n >= sizeof(uint32_t)) {
+            *(p_dst.p_word)++ = *(p_src.p_word)++;
+            n -= sizeof(uint32_t);
+        }
+    } else if (n >= sizeof(uint32_t)) {
+        /*
+         * The source is not aligned relative to the destination. Read aligned
+         * source words and merge each pair into a destination word, without
+         * relying on unaligned accesses. Only words holding bytes to copy are
+         * read.
+         */
+        shift = (uint32_t)ADDR_WORD_UNALIGNED(p_src.uint_addr) * 8U;
+        p_src.uint_addr -= ADDR_WORD_UNALIGNED(p_src.uint_addr);
+        word = *(p_src.p_word)++;
+
+        while (n >= sizeof(uint32_t)) {
+            next = *(p_src.p_word)++;
+            *(p_dst.p_word)++ = MERGE_WORDS(word, next, shift);
+            word = next;
+            n -= sizeof(uint32_t);
+        }
+
+        /* Back to the first source byte not copied yet. */
+        p_src.uint_addr -= sizeof(uint32_t) - (shift / 8U);
     }
 
     /* Byte copy for the remaining bytes. */
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2020-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -21,6 +23,16 @@ void *memset(void *s, int c, size_t n)
         n--;
     }
 
+    /* Four words per iteration for large areas. */
+    while (n >= 4 * sizeof(uint32_t)) {
+        p_mem.p_word[0] = pattern_word;
+        p_mem.p_word[1] = pattern_word;
+        p_mem.p_word[2] = pattern_word;
+        p_mem.p_word[3] = pattern_word;
+        p_mem.p_word += 4;
+        n -= 4 * sizeof(uint32_t);
+    }
+
     while (n >= sizeof(uint32_t)) {
         *p_mem.p_word++ = pattern_word;
         n -= sizeof(uint32_t);
@@ -8,6 +8,7 @@
  *
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "aapcs_local.h"
 #include "async.h"
@@ -19,6 +20,8 @@
 #include "runtime_defs.h"
 #include "stack_watermark.h"
 #include "spm.h"
+#include "spm_perf_counters.h"
+#include "spm_trace.h"
 #include "tfm_hal_isolation.h"
 #include "tfm_hal_platform.h"
 #include "tfm_nspm.h"
@@ -167,6 +170,63 @@ static void prv_process_metadata(struct partition_t *p_pt)
     p_pt->p_metadata = p_rt_meta;
 }
 
+#if CONFIG_TFM_PRIORITY_INHERITANCE == 1
+#define MANIFEST_PRIORITY(p_pt) \
+    ((uint8_t)TO_THREAD_PRIORITY(PARTITION_PRIORITY((p_pt)->p_ldinf->flags)))
+
+/*
+ * Run the service owner at least at the priority of the client of the
+ * message. A message from a client of higher priority than the manifest
+ * priority of the owner is counted until it is replied, whether it is still
+ * queued or already taken by psa_get(). Called in a critical section.
+ */
+static void inherit_priority(struct partition_t *p_owner,
+                             struct connection_t *p_connection)
+{
+    uint8_t priority = p_connection->p_client->thrd.priority;
+
+    p_connection->boosted = (priority < MANIFEST_PRIORITY(p_owner));
+    if (!p_connection->boosted) {
+        return;
+    }
+
+    p_owner->boosted_msgs++;
+    if (priority < p_owner->thrd.priority) {
+        thrd_set_priority(&p_owner->thrd, priority);
+    }
+}
+
+/*
+ * Give the service owner back its manifest priority once all its boosted
+ * messages are replied. Until then it keeps the highest inherited priority.
+ * Return true if the priority is lowered. Called in a critical section.
+ */
+static bool restore_priority(struct partition_t *p_owner,
+                             struct connection_t *p_connection)
+{
+    uint8_t priority = MANIFEST_PRIORITY(p_owner);
+
+    if (!p_connection->boosted) {
+        return false;
+    }
+
+    p_connection->boosted = false;
+    SPM_ASSERT(p_owner->boosted_msgs > 0);
+    p_owner->boosted_msgs--;
+
+    if ((p_owner->boosted_msgs != 0) || (p_owner->thrd.priority == priority)) {
+        return false;
+    }
+
+    thrd_set_priority(&p_owner->thrd, priority);
+
+    return true;
+}
+#else
+#define inherit_priority(p_owner, p_connection)
+#define restore_priority(p_owner, p_connection)  false
+#endif /* CONFIG_TFM_PRIORITY_INHERITANCE == 1 */
+
 /*
  * Send message and wake up the SP who is waiting on message queue, block the
  * current thread and trigger scheduler.
@@ -174,8 +234,10 @@ static void prv_process_metadata(struct partition_t *p_pt)
 psa_status_t backend_messaging(struct connection_t *p_connection)
 {
     struct partition_t *p_owner = NULL;
+    struct service_t *p_service;
     psa_signal_t signal = 0;
     psa_status_t ret = PSA_SUCCESS;
+    struct critical_section_t cs_assert = CRITICAL_SECTION_STATIC_INIT;
 
     if (!p_connection || !p_connection->service ||
         !p_connection->service->p_ldinf         ||
@@ -186,7 +248,20 @@ psa_status_t backend_messaging(struct connection_t *p_connection)
     p_owner = p_connection->service->partition;
     signal = p_connection->service->p_ldinf->signal;
 
-    UNI_LIST_INSERT_AFTER(p_owner, p_connection, p_handles);
+    /* The owner's writable copy of the service, which holds the queue. */
+    p_service = &p_owner->services[p_connection->service - p_owner->services];
+
+    /* Queue the message at the tail, psa_get() takes it from the head. */
+    p_connection->p_handles = NULL;
+    CRITICAL_SECTION_ENTER(cs_assert);
+    if (p_service->msg_tail) {
+        p_service->msg_tail->p_handles = p_connection;
+    } else {
+        p_service->msg_head = p_connection;
+    }
+    p_service->msg_tail = p_connection;
+    inherit_priority(p_owner, p_connection);
+    CRITICAL_SECTION_LEAVE(cs_assert);
 
     /* Messages put. Update signals */
     ret = backend_assert_signal(p_owner, signal);
@@ -212,6 +287,7 @@ psa_status_t backend_messaging(struct connection_t *p_connection)
 psa_status_t backend_replying(struct connection_t *handle, int32_t status)
 {
     struct partition_t *client = handle->p_client;
+    psa_status_t ret;
 
     if (tfm_spm_is_rpc_msg(handle)) {
         /*
@@ -223,11 +299,18 @@ psa_status_t backend_replying(struct connection_t *handle, int32_t status)
         handle->reply_value = (uintptr_t)status;
         handle->msg.rhandle = handle;
         UNI_LIST_INSERT_AFTER(client, handle, p_handles);
-        return backend_assert_signal(handle->p_client, ASYNC_MSG_REPLY);
     } else {
         handle->p_client->reply_value = (uintptr_t)status;
-        return backend_assert_signal(handle->p_client, ASYNC_MSG_REPLY);
     }
+
+    ret = backend_assert_signal(handle->p_client, ASYNC_MSG_REPLY);
+
+    /* A thread of higher priority than the replier may be runnable now */
+    if (restore_priority(handle->service->partition, handle)) {
+        ret = STATUS_NEED_SCHEDULE;
+    }
+
+    return ret;
 }
 
 extern void common_sfn_thread(void *param);
@@ -498,6 +581,15 @@ uint64_t ipc_schedule(uint32_t exc_return)
          */
         ARCH_FLUSH_FP_CONTEXT();
 
+        SPM_TRACE(TFM_SPM_TRACE_CONTEXT_SWITCH, p_part_next,
+                  p_part_curr->p_ldinf->pid, 0);
+        spm_perf_counters_switch(p_part_curr);
+
+        if (p_part_next->p_ldinf->pid == TFM_SP_IDLE) {
+            /* Nothing else to run, look for new stack watermarks */
+            stack_watermark_update_step();
+        }
+
         /*
          * If required, let the platform update boundary based on its
          * implementation. Change privilege, MPU or other configurations.
@@ -505,6 +597,7 @@ uint64_t ipc_schedule(uint32_t exc_return)
         FIH_CALL(tfm_hal_boundary_need_switch, fih_bool,
                  p_part_curr->boundary, p_part_next->boundary);
         if (fih_not_eq(fih_bool, fih_int_encode(false))) {
+            SPM_TRACE(TFM_SPM_TRACE_BOUNDARY_SWITCH, p_part_next, 0, 0);
             FIH_CALL(tfm_hal_activate_boundary, fih_rc,
                      p_part_next->p_ldinf, p_part_next->boundary);
             if (fih_not_eq(fih_rc, fih_int_encode(TFM_HAL_SUCCESS))) {
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config_spm.h"
+
+#if (CONFIG_TFM_SPM_DMA_COPY_THRESHOLD > 0) && (CONFIG_TFM_SPM_BACKEND_IPC == 1)
+
+#include "async.h"
+#include "critical_section.h"
+#include "dma_copy.h"
+#include "ffm/backend.h"
+#include "internal_status_code.h"
+#include "spm.h"
+#include "tfm_arch.h"
+#include "tfm_hal_dma.h"
+#include "utilities.h"
+
+uint32_t spm_iovec_copy(struct partition_t *p_pt, void *dst, const void *src,
+                        size_t size, uint32_t retval)
+{
+    struct critical_section_t cs_signal = CRITICAL_SECTION_STATIC_INIT;
+
+    /*
+     * The partition waits for the copy on ASYNC_MSG_REPLY, like on a
+     * psa_call() reply. Mailbox NS Agents handle that signal themselves.
+     */
+    if ((size < CONFIG_TFM_SPM_DMA_COPY_THRESHOLD) ||
+        ((p_pt->signals_allowed & ASYNC_MSG_REPLY) != 0)) {
+        spm_memcpy(dst, src, size);
+        return retval;
+    }
+
+    p_pt->reply_value = retval;
+
+    if (tfm_hal_dma_copy_start(dst, src, size, p_pt) != TFM_HAL_SUCCESS) {
+        spm_memcpy(dst, src, size);
+        return retval;
+    }
+
+    if (backend_wait_signals(p_pt, ASYNC_MSG_REPLY) == 0) {
+        return (uint32_t)STATUS_NEED_SCHEDULE;
+    }
+
+    /* The copy completed before the partition could wait for it */
+    CRITICAL_SECTION_ENTER(cs_signal);
+    p_pt->signals_asserted &= ~ASYNC_MSG_REPLY;
+    CRITICAL_SECTION_LEAVE(cs_signal);
+
+    return retval;
+}
+
+void spm_dma_copy_done(void *p_ctx, enum tfm_hal_status_t status)
+{
+    struct partition_t *p_pt = (struct partition_t *)p_ctx;
+
+    /* The IOVEC cannot be left partially copied */
+    if ((p_pt == NULL) || (status != TFM_HAL_SUCCESS)) {
+        tfm_core_panic();
+    }
+
+    if (backend_assert_signal(p_pt, ASYNC_MSG_REPLY) == STATUS_NEED_SCHEDULE) {
+        arch_attempt_schedule();
+    }
+}
+
+#endif /* CONFIG_TFM_SPM_DMA_COPY_THRESHOLD > 0 &&
+        * CONFIG_TFM_SPM_BACKEND_IPC == 1
+        */
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __DMA_COPY_H__
+#define __DMA_COPY_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config_spm.h"
+#include "spm.h"
+#include "tfm_hal_defs.h"
+#include "utilities.h"
+
+#if (CONFIG_TFM_SPM_DMA_COPY_THRESHOLD > 0) && (CONFIG_TFM_SPM_BACKEND_IPC == 1)
+/**
+ * \brief   Copy an IOVEC for a partition. Copies of at least
+ *          CONFIG_TFM_SPM_DMA_COPY_THRESHOLD bytes are given to the platform
+ *          DMA and the partition is blocked until they complete.
+ *
+ * \param[in] p_pt      The partition calling psa_read() or psa_write().
+ * \param[in] dst       The destination of the copy.
+ * \param[in] src       The source of the copy.
+ * \param[in] size      The size of the copy in bytes.
+ * \param[in] retval    The value to return to the partition.
+ *
+ * \retval STATUS_NEED_SCHEDULE The partition is blocked, it gets retval
+ *                              once the copy completes.
+ * \retval retval               The copy is complete.
+ */
+uint32_t spm_iovec_copy(struct partition_t *p_pt, void *dst, const void *src,
+                        size_t size, uint32_t retval);
+
+/**
+ * \brief   Complete a copy started with tfm_hal_dma_copy_start(). Platforms
+ *          call this function from their DMA interrupt handler.
+ *
+ * \param[in] p_ctx     The context given to tfm_hal_dma_copy_start().
+ * \param[in] status    TFM_HAL_SUCCESS if the copy succeeded. A failed copy
+ *                      is a fatal error.
+ */
+void spm_dma_copy_done(void *p_ctx, enum tfm_hal_status_t status);
+#else
+static inline uint32_t spm_iovec_copy(struct partition_t *p_pt, void *dst,
+                                      const void *src, size_t size,
+                                      uint32_t retval)
+{
+    (void)p_pt;
+    spm_memcpy(dst, src, size);
+    return retval;
+}
+#endif
+
+#endif /* __DMA_COPY_H__ */
@@ -13,6 +13,7 @@
 #include "bitops.h"
 #include "current.h"
 #include "fih.h"
+#include "spm_trace.h"
 #include "svc_num.h"
 #include "tfm_arch.h"
 #include "tfm_hal_interrupt.h"
@@ -190,23 +191,44 @@ const struct irq_load_info_t *get_irq_info_for_signal(
                                     const struct partition_load_info_t *p_ldinf,
                                     psa_signal_t signal)
 {
-    size_t i;
+    uint32_t idx;
     const struct irq_load_info_t *irq_info;
 
     if (!IS_ONLY_ONE_BIT_IN_UINT32(signal)) {
         return NULL;
     }
 
+    /*
+     * The manifest tool assigns the IRQ signals from the most significant
+     * bit, in the order of the IRQs in the load info. The leading zeros of
+     * the signal are the index of its IRQ.
+     */
+    idx = __CLZ(signal);
+    if (idx >= p_ldinf->nirqs) {
+        return NULL;
+    }
+
     irq_info = LOAD_INFO_IRQ(p_ldinf);
-    for (i = 0; i < p_ldinf->nirqs; i++) {
-        if (irq_info[i].signal == signal) {
-            return &irq_info[i];
-        }
+    if (irq_info[idx].signal != signal) {
+        return NULL;
     }
 
-    return NULL;
+    return &irq_info[idx];
 }
 
+#if CONFIG_TFM_SLIH_COALESCE_SCHEDULE == 1
+/* A SLIH signal is waiting for the next tick to be scheduled */
+static volatile bool slih_schedule_pending;
+
+void spm_interrupt_tick(void)
+{
+    if (slih_schedule_pending) {
+        slih_schedule_pending = false;
+        arch_attempt_schedule();
+    }
+}
+#endif
+
 void spm_handle_interrupt(void *p_pt, const struct irq_load_info_t *p_ildi)
 {
     psa_flih_result_t flih_result;
@@ -248,10 +270,19 @@ void spm_handle_interrupt(void *p_pt, const struct irq_load_info_t *p_ildi)
     }
 
     if (flih_result == PSA_FLIH_SIGNAL) {
+        SPM_TRACE(TFM_SPM_TRACE_IRQ_ASSERT, p_part, p_ildi->signal,
+                  p_ildi->source);
         ret = backend_assert_signal(p_pt, p_ildi->signal);
         /* In SFN backend, there is only one thread, no thread switch. */
 #if CONFIG_TFM_SPM_BACKEND_SFN != 1
         if (ret == STATUS_NEED_SCHEDULE) {
+#if CONFIG_TFM_SLIH_COALESCE_SCHEDULE == 1
+            if (p_ildi->flih_func == NULL) {
+                /* Schedule all the SLIH signals of this tick at once */
+                slih_schedule_pending = true;
+                return;
+            }
+#endif
             arch_attempt_schedule();
         }
 #else
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2021, Arm Limited. All rights reserved.
- * Copyright (c) 2022 Cypress Semiconductor Corporation (an Infineon
+ * Copyright (c) 2022-2025 Cypress Semiconductor Corporation (an Infineon
  * company) or an affiliate of Cypress Semiconductor Corporation. All rights
  * reserved.
  *
@@ -44,6 +44,17 @@ const struct irq_load_info_t *get_irq_info_for_signal(
  */
 void spm_handle_interrupt(void *p_pt, const struct irq_load_info_t *p_ildi);
 
+#if CONFIG_TFM_SLIH_COALESCE_SCHEDULE == 1
+/**
+ * \brief Run the scheduler if a SLIH signal was asserted since the previous
+ *        tick. With CONFIG_TFM_SLIH_COALESCE_SCHEDULE, platforms must call it
+ *        from the periodic secure interrupt started by
+ *        tfm_hal_spm_tick_init(), the SLIH partitions are not scheduled
+ *        otherwise.
+ */
+void spm_interrupt_tick(void);
+#endif
+
 /*
  * Prepare execution context for deprivileged FLIH functions
  * Parameters:
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2023-2024, Arm Limited. All rights reserved.
- * Copyright (c) 2023 Cypress Semiconductor Corporation (an Infineon company)
+ * Copyright (c) 2023-2025 Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -11,6 +11,7 @@
 #include "fih.h"
 #include "internal_status_code.h"
 #include "spm.h"
+#include "spm_perf_counters.h"
 #include "tfm_hal_isolation.h"
 #include "tfm_multi_core.h"
 #include "ffm/mailbox_agent_api.h"
@@ -52,6 +53,8 @@ psa_status_t tfm_spm_agent_psa_call(psa_handle_t handle,
     /* Set Mailbox client data in connection handle for message reply. */
     p_connection->client_data = client_data_stateless;
 
+    SPM_PERF_SERVICE_CALL(p_connection->service);
+
     return backend_messaging(p_connection);
 }
 
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "config_spm.h"
+
+#if CONFIG_TFM_MEM_CHECK_CACHE_ENTRIES > 0
+
+#include "critical_section.h"
+#include "fih.h"
+#include "mem_check_cache.h"
+#include "spm.h"
+#include "tfm_hal_isolation.h"
+#include "utilities.h"
+
+/* A range accepted by tfm_hal_memory_check() */
+struct mem_check_range_t {
+    bool valid;
+    uintptr_t boundary;
+    uintptr_t base;
+    size_t size;
+    uint32_t access_type;
+};
+
+static struct mem_check_range_t range_cache[CONFIG_TFM_MEM_CHECK_CACHE_ENTRIES];
+static uint32_t range_cache_next;
+
+/*
+ * Incremented by each flush. A range checked before a flush is not
+ * recorded after it.
+ */
+static uint32_t generation;
+
+/*
+ * Whether the range contains the requested one. A read-write range contains
+ * read-only and write-only requests, all the other access types must be the
+ * same.
+ */
+static bool range_contains(const struct mem_check_range_t *p_range,
+                           uintptr_t base, size_t size, uint32_t access_type)
+{
+    uint32_t other_types = ~(uint32_t)TFM_HAL_ACCESS_READWRITE;
+
+    return ((p_range->access_type & access_type) == access_type) &&
+           ((p_range->access_type & other_types) ==
+            (access_type & other_types)) &&
+           (base >= p_range->base) && (size <= p_range->size) &&
+           ((base - p_range->base) <= (p_range->size - size));
+}
+
+/* Whether the range has been checked for the boundary and contains the request */
+static bool range_covers(const struct mem_check_range_t *p_range,
+                         uintptr_t boundary, uintptr_t base, size_t size,
+                         uint32_t access_type)
+{
+    return p_range->valid && (p_range->boundary == boundary) &&
+           range_contains(p_range, base, size, access_type);
+}
+
+/* Record a checked range, unless a flush happened since it was checked. */
+static void record_range(struct mem_check_range_t *p_range, uint32_t gen,
+                         uintptr_t boundary, uintptr_t base, size_t size,
+                         uint32_t access_type)
+{
+    struct critical_section_t cs_assert = CRITICAL_SECTION_STATIC_INIT;
+
+    /* NS ranges depend on the NS privilege and MPU, never record them */
+    SPM_ASSERT((access_type & TFM_HAL_ACCESS_NS) == 0);
+
+    CRITICAL_SECTION_ENTER(cs_assert);
+    if (gen == generation) {
+        p_range->boundary = boundary;
+        p_range->base = base;
+        p_range->size = size;
+        p_range->access_type = access_type;
+        p_range->valid = true;
+    }
+    CRITICAL_SECTION_LEAVE(cs_assert);
+}
+
+FIH_RET_TYPE(enum tfm_hal_status_t) spm_memory_check(
+                                                const struct partition_t *p_pt,
+                                                uintptr_t base, size_t size,
+                                                uint32_t access_type)
+{
+    fih_int fih_rc = FIH_FAILURE;
+    uint32_t gen;
+    uint32_t i;
+
+    /*
+     * Empty and wrapping ranges are left to the platform. So are NS ranges:
+     * their check depends on the privilege of the NS caller and on the NS
+     * MPU, which the NS software changes without the SPM knowing.
+     */
+    if (((access_type & TFM_HAL_ACCESS_NS) != 0) ||
+        (size == 0) || (base > (UINTPTR_MAX - size))) {
+        FIH_CALL(tfm_hal_memory_check, fih_rc,
+                 p_pt->boundary, base, size, access_type);
+        FIH_RET(fih_rc);
+    }
+
+    for (i = 0; i < CONFIG_TFM_MEM_CHECK_CACHE_ENTRIES; i++) {
+        if (range_covers(&range_cache[i], p_pt->boundary,
+                         base, size, access_type)) {
+            FIH_RET(fih_int_encode(TFM_HAL_SUCCESS));
+        }
+    }
+
+    gen = generation;
+    FIH_CALL(tfm_hal_memory_check, fih_rc,
+             p_pt->boundary, base, size, access_type);
+
+    if (fih_eq(fih_rc, fih_int_encode(TFM_HAL_SUCCESS))) {
+        /* Replace the entries in turn */
+        record_range(&range_cache[range_cache_next], gen, p_pt->boundary,
+                     base, size, access_type);
+        range_cache_next = (range_cache_next + 1) %
+                           CONFIG_TFM_MEM_CHECK_CACHE_ENTRIES;
+    }
+
+    FIH_RET(fih_rc);
+}
+
+void spm_memory_check_flush(void)
+{
+    struct critical_section_t cs_assert = CRITICAL_SECTION_STATIC_INIT;
+    uint32_t i;
+
+    CRITICAL_SECTION_ENTER(cs_assert);
+    generation++;
+    for (i = 0; i < CONFIG_TFM_MEM_CHECK_CACHE_ENTRIES; i++) {
+        range_cache[i].valid = false;
+    }
+    CRITICAL_SECTION_LEAVE(cs_assert);
+}
+
+#endif /* CONFIG_TFM_MEM_CHECK_CACHE_ENTRIES > 0 */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __MEM_CHECK_CACHE_H__
+#define __MEM_CHECK_CACHE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config_spm.h"
+#include "fih.h"
+#include "psa/error.h"
+#include "spm.h"
+#include "tfm_hal_defs.h"
+#include "tfm_hal_isolation.h"
+
+#if CONFIG_TFM_MEM_CHECK_CACHE_ENTRIES > 0
+/**
+ * \brief   Check a memory range of a partition like tfm_hal_memory_check(),
+ *          skipping the platform check for ranges already validated.
+ *          Ranges checked with TFM_HAL_ACCESS_NS are always passed to the
+ *          platform, and are never cached.
+ *
+ * \param[in] p_pt         The partition accessing the memory.
+ * \param[in] base         The base address of the range.
+ * \param[in] size         The size of the range.
+ * \param[in] access_type  The access types to check, TFM_HAL_ACCESS_*.
+ *
+ * \return  The result of tfm_hal_memory_check() for the range.
+ */
+FIH_RET_TYPE(enum tfm_hal_status_t) spm_memory_check(
+                                                const struct partition_t *p_pt,
+                                                uintptr_t base, size_t size,
+                                                uint32_t access_type);
+
+/**
+ * \brief   Forget all the validated ranges. Called when the memory map seen
+ *          by the platform check for secure partitions changes, such as
+ *          on a reconfiguration of the boundaries.
+ */
+void spm_memory_check_flush(void);
+#else
+#define spm_memory_check(p_pt, base, size, access_type) \
+    tfm_hal_memory_check((p_pt)->boundary, (base), (size), (access_type))
+#define spm_memory_check_flush()
+#endif
+
+#endif /* __MEM_CHECK_CACHE_H__ */
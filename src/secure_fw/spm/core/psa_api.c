@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2019-2024, Arm Limited. All rights reserved.
- * Copyright (c) 2022-2024 Cypress Semiconductor Corporation (an Infineon
+ * Copyright (c) 2022-2025 Cypress Semiconductor Corporation (an Infineon
  * company) or an affiliate of Cypress Semiconductor Corporation. All rights
  * reserved.
  *
@@ -28,6 +28,7 @@
 #include "tfm_hal_platform.h"
 #include "tfm_plat_otp.h"
 #include "tfm_psa_call_pack.h"
+#include "spm_trace.h"
 #include "tfm_spm_log.h"
 #include "tfm_hal_isolation.h"
 
@@ -192,6 +193,9 @@ psa_status_t tfm_spm_partition_psa_get(psa_signal_t signal, psa_msg_t *msg)
         }
     }
 
+    SPM_TRACE(TFM_SPM_TRACE_PSA_GET, partition, signal,
+              spm_connection_index(handle));
+
     spm_memcpy(msg, &handle->msg, sizeof(psa_msg_t));
 
     return ret;
@@ -222,6 +226,9 @@ psa_status_t tfm_spm_partition_psa_reply(psa_handle_t msg_handle,
         tfm_core_panic();
     }
 
+    SPM_TRACE(TFM_SPM_TRACE_PSA_REPLY, GET_CURRENT_COMPONENT(), status,
+              spm_connection_index(handle));
+
     switch (handle->msg.type) {
     case PSA_IPC_CONNECT:
         /*
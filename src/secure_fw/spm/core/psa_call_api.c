@@ -12,6 +12,10 @@
 #include "critical_section.h"
 #include "ffm/backend.h"
 #include "ffm/psa_api.h"
+#include "internal_status_code.h"
+#include "mem_check_cache.h"
+#include "spm_perf_counters.h"
+#include "spm_trace.h"
 #include "tfm_hal_isolation.h"
 #include "tfm_psa_call_pack.h"
 #include "utilities.h"
@@ -59,8 +63,8 @@ psa_status_t spm_associate_call_params(struct connection_t *p_connection,
      * if the memory reference for the wrap input vector is invalid or not
      * readable.
      */
-    FIH_CALL(tfm_hal_memory_check, fih_rc,
-             curr_partition->boundary, (uintptr_t)inptr,
+    FIH_CALL(spm_memory_check, fih_rc,
+             curr_partition, (uintptr_t)inptr,
              ivec_num * sizeof(psa_invec), TFM_HAL_ACCESS_READABLE | ns_access);
     if (fih_not_eq(fih_rc, fih_int_encode(PSA_SUCCESS))) {
         return PSA_ERROR_PROGRAMMER_ERROR;
@@ -74,8 +78,8 @@ psa_status_t spm_associate_call_params(struct connection_t *p_connection,
      * actual length later. It is a PROGRAMMER ERROR if the memory reference for
      * the wrap output vector is invalid or not read-write.
      */
-    FIH_CALL(tfm_hal_memory_check, fih_rc,
-             curr_partition->boundary, (uintptr_t)outptr,
+    FIH_CALL(spm_memory_check, fih_rc,
+             curr_partition, (uintptr_t)outptr,
              ovec_num * sizeof(psa_outvec), TFM_HAL_ACCESS_READWRITE | ns_access);
     if (fih_not_eq(fih_rc, fih_int_encode(PSA_SUCCESS))) {
         return PSA_ERROR_PROGRAMMER_ERROR;
@@ -115,8 +119,8 @@ psa_status_t spm_associate_call_params(struct connection_t *p_connection,
      */
     for (i = 0; i < ivec_num; i++) {
         TFM_COVERITY_DEVIATE_LINE(MISRA_C_2023_Rule_11_6, "Intentional pointer cast, void will fit into uintptr_t, function only reads data")
-        FIH_CALL(tfm_hal_memory_check, fih_rc,
-                 curr_partition->boundary, (uintptr_t)ivecs_local[i].base,
+        FIH_CALL(spm_memory_check, fih_rc,
+                 curr_partition, (uintptr_t)ivecs_local[i].base,
                  ivecs_local[i].len, TFM_HAL_ACCESS_READABLE | ns_access);
         if (fih_not_eq(fih_rc, fih_int_encode(PSA_SUCCESS))) {
             return PSA_ERROR_PROGRAMMER_ERROR;
@@ -139,8 +143,8 @@ psa_status_t spm_associate_call_params(struct connection_t *p_connection,
      */
     for (i = 0; i < ovec_num; i++) {
         TFM_COVERITY_DEVIATE_LINE(MISRA_C_2023_Rule_11_6, "Intentional pointer cast, void will fit into uintptr_t")
-        FIH_CALL(tfm_hal_memory_check, fih_rc,
-                 curr_partition->boundary, (uintptr_t)ovecs_local[i].base,
+        FIH_CALL(spm_memory_check, fih_rc,
+                 curr_partition, (uintptr_t)ovecs_local[i].base,
                  ovecs_local[i].len, TFM_HAL_ACCESS_READWRITE | ns_access);
         if (fih_not_eq(fih_rc, fih_int_encode(PSA_SUCCESS))) {
             return PSA_ERROR_PROGRAMMER_ERROR;
@@ -181,5 +185,18 @@ psa_status_t tfm_spm_client_psa_call(psa_handle_t handle,
         return status;
     }
 
-    return backend_messaging(p_connection);
+    SPM_TRACE(TFM_SPM_TRACE_PSA_CALL, GET_CURRENT_COMPONENT(),
+              p_connection->service->p_ldinf->sid,
+              spm_connection_index(p_connection));
+    SPM_PERF_SERVICE_CALL(p_connection->service);
+
+    status = backend_messaging(p_connection);
+
+    /* The call returns now unless the caller waits for the reply */
+    if (status != STATUS_NEED_SCHEDULE) {
+        SPM_TRACE(TFM_SPM_TRACE_PSA_CALL_RETURN, GET_CURRENT_COMPONENT(),
+                  status, spm_connection_index(p_connection));
+    }
+
+    return status;
 }
@@ -7,6 +7,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
+#include "dma_copy.h"
 #include "ffm/psa_api.h"
 #include "spm.h"
 #include "utilities.h"
@@ -17,6 +18,7 @@ size_t tfm_spm_partition_psa_read(psa_handle_t msg_handle, uint32_t invec_idx,
                                   void *buffer, size_t num_bytes)
 {
     size_t bytes, remaining;
+    const char *src;
     struct connection_t *handle = NULL;
     struct partition_t *curr_partition = GET_CURRENT_COMPONENT();
     fih_int fih_rc = FIH_FAILURE;
@@ -75,13 +77,14 @@ size_t tfm_spm_partition_psa_read(psa_handle_t msg_handle, uint32_t invec_idx,
 
     bytes = num_bytes < remaining ? num_bytes : remaining;
 
-    spm_memcpy(buffer, (char *)handle->invec_base[invec_idx] +
-                               handle->invec_accessed[invec_idx], bytes);
+    src = (char *)handle->invec_base[invec_idx] +
+          handle->invec_accessed[invec_idx];
 
     /* Update the data size read */
     handle->invec_accessed[invec_idx] += bytes;
 
-    return bytes;
+    return (size_t)spm_iovec_copy(curr_partition, buffer, src, bytes,
+                                  (uint32_t)bytes);
 }
 
 size_t tfm_spm_partition_psa_skip(psa_handle_t msg_handle, uint32_t invec_idx,
@@ -147,6 +150,7 @@ size_t tfm_spm_partition_psa_skip(psa_handle_t msg_handle, uint32_t invec_idx,
 psa_status_t tfm_spm_partition_psa_write(psa_handle_t msg_handle, uint32_t outvec_idx,
                                          const void *buffer, size_t num_bytes)
 {
+    char *dst;
     struct connection_t *handle = NULL;
     struct partition_t *curr_partition = GET_CURRENT_COMPONENT();
     fih_int fih_rc = FIH_FAILURE;
@@ -205,11 +209,12 @@ psa_status_t tfm_spm_partition_psa_write(psa_handle_t msg_handle, uint32_t outve
         tfm_core_panic();
     }
 
-    spm_memcpy((char *)handle->outvec_base[outvec_idx] +
-               handle->outvec_written[outvec_idx], buffer, num_bytes);
+    dst = (char *)handle->outvec_base[outvec_idx] +
+          handle->outvec_written[outvec_idx];
 
     /* Update the data size written */
     handle->outvec_written[outvec_idx] += num_bytes;
 
-    return PSA_SUCCESS;
+    return (psa_status_t)spm_iovec_copy(curr_partition, dst, buffer, num_bytes,
+                                        (uint32_t)PSA_SUCCESS);
 }
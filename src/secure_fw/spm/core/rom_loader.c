@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2021-2024, Arm Limited. All rights reserved.
- * Copyright (c) 2022 Cypress Semiconductor Corporation (an Infineon
+ * Copyright (c) 2022-2025 Cypress Semiconductor Corporation (an Infineon
  * company) or an affiliate of Cypress Semiconductor Corporation. All rights
  * reserved.
  *
@@ -14,6 +14,7 @@
 #include "memory_symbols.h"
 #include "region_defs.h"
 #include "spm.h"
+#include "spm_perf_counters.h"
 #include "tfm_hal_interrupt.h"
 #include "tfm_plat_defs.h"
 #include "utilities.h"
@@ -123,6 +124,8 @@ struct partition_t *load_a_partition_assuredly(struct partition_head_t *head)
 
     ldinf_sa += LOAD_INFSZ_BYTES(p_ptldinf);
 
+    spm_perf_counters_add_partition(partition);
+
     UNI_LIST_INSERT_AFTER(head, partition, next);
 
     return partition;
@@ -150,10 +153,18 @@ uint32_t load_services_assuredly(struct partition_t *p_partition,
      * The loop won't go in the NULL case.
      */
     services = tfm_allocate_service_assuredly(p_ptldinf->nservices);
+#if CONFIG_TFM_SPM_BACKEND_IPC == 1
+    p_partition->services = services;
+#endif
     for (i = 0; i < p_ptldinf->nservices && services; i++) {
         services[i].p_ldinf = &p_servldinf[i];
         services[i].partition = p_partition;
         services[i].next = NULL;
+#if CONFIG_TFM_SPM_BACKEND_IPC == 1
+        services[i].msg_head = NULL;
+        services[i].msg_tail = NULL;
+#endif
+        spm_perf_counters_add_service(&services[i]);
 
         BACKEND_SERVICE_SET(service_setting, &p_servldinf[i]);
 
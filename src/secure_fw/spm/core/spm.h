@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2020-2024, Arm Limited. All rights reserved.
- * Copyright (c) 2021-2024 Cypress Semiconductor Corporation (an Infineon
+ * Copyright (c) 2021-2025 Cypress Semiconductor Corporation (an Infineon
  * company) or an affiliate of Cypress Semiconductor Corporation. All rights
  * reserved.
  *
@@ -20,6 +20,7 @@
 #include "lists.h"
 #include "runtime_defs.h"
 #include "thread.h"
+#include "tfm_perf_counters_defs.h"
 #include "psa/service.h"
 #include "load/partition_defs.h"
 #include "load/interrupt_defs.h"
@@ -97,9 +98,12 @@ struct connection_t {
     uint32_t iovec_status;                   /* MM-IOVEC status                */
 #endif
 #if CONFIG_TFM_SPM_BACKEND_IPC == 1
-    struct connection_t *p_handles;          /* Handle(s) link                 */
+    struct connection_t *p_handles;          /* Handle(s) or message queue link */
     uintptr_t reply_value;                   /* Result of this operation, if aynchronous */
 #endif
+#if CONFIG_TFM_PRIORITY_INHERITANCE == 1
+    bool boosted;                            /* Raised the service owner priority */
+#endif
 };
 
 /* Partition runtime type */
@@ -114,10 +118,22 @@ struct partition_t {
     struct context_ctrl_t              ctx_ctrl;
     struct thread_t                    thrd;            /* IPC model */
     uintptr_t                          reply_value;
+    struct service_t                   *services;       /* Owned services */
+#if CONFIG_TFM_PRIORITY_INHERITANCE == 1
+    uint32_t                           boosted_msgs;    /* Boosted messages not
+                                                         * replied yet
+                                                         */
+#endif
 #else
     uint32_t                           state;           /* SFN model */
 #endif
     struct connection_t                *p_handles;
+#ifdef CONFIG_TFM_STACK_WATERMARKS
+    uint32_t                           stack_unused_words; /* Never used */
+#endif
+#if CONFIG_TFM_PERF_COUNTERS
+    struct tfm_perf_partition_counter_t *p_counter;     /* NULL if none */
+#endif
     struct partition_t                 *next;
 };
 
@@ -126,6 +142,13 @@ struct service_t {
     const struct service_load_info_t *p_ldinf;     /* Service load info      */
     struct partition_t *partition;                 /* Owner of the service   */
     struct service_t *next;                        /* For list operation     */
+#if CONFIG_TFM_SPM_BACKEND_IPC == 1
+    struct connection_t *msg_head;                 /* Oldest queued message  */
+    struct connection_t *msg_tail;                 /* Newest queued message  */
+#endif
+#if CONFIG_TFM_PERF_COUNTERS
+    struct tfm_perf_service_counter_t *p_counter;  /* NULL if none           */
+#endif
 };
 
 /**
@@ -145,19 +168,26 @@ psa_status_t spm_validate_connection(const struct connection_t *p_connection);
 /* Panic if invalid connection is given. */
 void spm_free_connection(struct connection_t *p_connection);
 
+#if CONFIG_TFM_SPM_TRACE_ENTRIES > 0
+/*
+ * Index of a connection in the connection pool. Identifies the connection in
+ * the SPM trace without exposing its address.
+ */
+uint32_t spm_connection_index(const struct connection_t *p_connection);
+#endif
+
 /******************** Partition management functions *************************/
 
 #if CONFIG_TFM_SPM_BACKEND_IPC == 1
 /*
- * Lookup and grab the last spotted handles containing the message
- * by the given signal. Only ONE signal bit can be accepted in 'signal',
- * multiple bits lead to 'no matched handles found to that signal'.
+ * Grab the oldest message queued to the service of the given signal.
+ * Only ONE signal bit can be accepted in 'signal', multiple bits lead
+ * to 'no matched handles found to that signal'.
  *
  * Returns NULL if no handles matched with the given signal.
  * Returns an internal handle instance if spotted, the instance
- * is moved out of partition handles. Partition available signals
- * also get updated based on the count of handles with given signal
- * still in the partition handles.
+ * is moved out of the service message queue. The signal is cleared
+ * from the partition available signals once the queue is empty.
  */
 struct connection_t *spm_get_handle_by_signal(struct partition_t *p_ptn,
                                               psa_signal_t signal);
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -8,6 +10,7 @@
 #include "critical_section.h"
 #include "internal_status_code.h"
 #include "spm.h"
+#include "spm_perf_counters.h"
 #include "tfm_pools.h"
 #include "load/service_defs.h"
 
@@ -113,8 +116,23 @@ void spm_init_connection_space(void)
 
 struct connection_t *spm_allocate_connection(void)
 {
+    struct connection_t *p_connection;
+#if CONFIG_TFM_PERF_COUNTERS
+    struct critical_section_t cs_assert = CRITICAL_SECTION_STATIC_INIT;
+#endif
+
     /* Get buffer for handle list structure from handle pool */
-    return (struct connection_t *)tfm_pool_alloc(connection_pool);
+    p_connection = (struct connection_t *)tfm_pool_alloc(connection_pool);
+
+#if CONFIG_TFM_PERF_COUNTERS
+    if (p_connection != NULL) {
+        CRITICAL_SECTION_ENTER(cs_assert);
+        SPM_PERF_LEVEL_INC(conn_in_use, conn_high_water);
+        CRITICAL_SECTION_LEAVE(cs_assert);
+    }
+#endif
+
+    return p_connection;
 }
 
 psa_status_t spm_validate_connection(const struct connection_t *p_connection)
@@ -128,6 +146,16 @@ psa_status_t spm_validate_connection(const struct connection_t *p_connection)
     return PSA_SUCCESS;
 }
 
+#if CONFIG_TFM_SPM_TRACE_ENTRIES > 0
+uint32_t spm_connection_index(const struct connection_t *p_connection)
+{
+    return (uint32_t)(((uintptr_t)p_connection -
+                       (uintptr_t)connection_pool->chunks) /
+                      (sizeof(struct connection_t) +
+                       sizeof(struct tfm_pool_chunk_t)));
+}
+#endif
+
 void spm_free_connection(struct connection_t *p_connection)
 {
     struct critical_section_t cs_assert = CRITICAL_SECTION_STATIC_INIT;
@@ -137,5 +165,6 @@ void spm_free_connection(struct connection_t *p_connection)
     CRITICAL_SECTION_ENTER(cs_assert);
     /* Back handle buffer to pool */
     tfm_pool_free(connection_pool, p_connection);
+    SPM_PERF_LEVEL_DEC(conn_in_use);
     CRITICAL_SECTION_LEAVE(cs_assert);
 }
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2018-2024, Arm Limited. All rights reserved.
- * Copyright (c) 2021-2024 Cypress Semiconductor Corporation (an Infineon
+ * Copyright (c) 2021-2025 Cypress Semiconductor Corporation (an Infineon
  * company) or an affiliate of Cypress Semiconductor Corporation. All rights
  * reserved.
  *
@@ -26,6 +26,7 @@
 #include "tfm_hal_interrupt.h"
 #include "tfm_hal_isolation.h"
 #include "spm.h"
+#include "spm_perf_counters.h"
 #include "tfm_peripherals_def.h"
 #include "tfm_nspm.h"
 #include "tfm_core_trustzone.h"
@@ -51,34 +52,40 @@ struct service_t *stateless_services_ref_tbl[STATIC_HANDLE_NUM_LIMIT];
 struct connection_t *spm_get_handle_by_signal(struct partition_t *p_ptn,
                                               psa_signal_t signal)
 {
-    struct connection_t *p_handle_iter;
-    struct connection_t **pr_handle_iter, **last_found_handle_holder = NULL;
+    struct service_t *p_service = NULL;
+    struct connection_t *p_handle;
     struct critical_section_t cs_assert = CRITICAL_SECTION_STATIC_INIT;
-    uint32_t nr_found_msgs = 0;
-
-    CRITICAL_SECTION_ENTER(cs_assert);
+    uint32_t i;
 
-    /* Return the last found message which applies a FIFO mechanism. */
-    UNI_LIST_FOREACH_NODE_PNODE(pr_handle_iter, p_handle_iter,
-                                p_ptn, p_handles) {
-        if (p_handle_iter->service->p_ldinf->signal == signal) {
-            last_found_handle_holder = pr_handle_iter;
-            nr_found_msgs++;
+    /* Bounded by the number of services, not by the pending messages. */
+    for (i = 0; i < p_ptn->p_ldinf->nservices; i++) {
+        if (p_ptn->services[i].p_ldinf->signal == signal) {
+            p_service = &p_ptn->services[i];
+            break;
         }
     }
 
-    if (last_found_handle_holder) {
-        p_handle_iter = *last_found_handle_holder;
-        UNI_LIST_REMOVE_NODE_BY_PNODE(last_found_handle_holder, p_handles);
+    if (!p_service) {
+        return NULL;
+    }
 
-        if (nr_found_msgs == 1) {
+    CRITICAL_SECTION_ENTER(cs_assert);
+
+    /* Messages are queued at the tail, the head is the oldest one. */
+    p_handle = p_service->msg_head;
+    if (p_handle) {
+        p_service->msg_head = p_handle->p_handles;
+        p_handle->p_handles = NULL;
+
+        if (!p_service->msg_head) {
+            p_service->msg_tail = NULL;
             p_ptn->signals_asserted &= ~signal;
         }
     }
 
     CRITICAL_SECTION_LEAVE(cs_assert);
 
-    return p_handle_iter;
+    return p_handle;
 }
 #endif /* CONFIG_TFM_SPM_BACKEND_IPC == 1 */
 
@@ -366,6 +373,7 @@ uint32_t tfm_spm_init(void)
     fih_int fih_rc = FIH_FAILURE;
 
     spm_init_connection_space();
+    spm_perf_counters_init();
 
     UNI_LISI_INIT_NODE(PARTITION_LIST_ADDR, next);
     UNI_LISI_INIT_NODE(&services_listhead, next);
@@ -397,6 +405,13 @@ uint32_t tfm_spm_init(void)
         backend_init_comp_assuredly(partition, service_setting);
     }
 
+#if CONFIG_TFM_SLIH_COALESCE_SCHEDULE == 1
+    /* The SLIH partitions are only scheduled by the periodic tick */
+    if (tfm_hal_spm_tick_init() != TFM_HAL_SUCCESS) {
+        tfm_core_panic();
+    }
+#endif
+
 #if CONFIG_TFM_HAL_FINISH_BOOT
     /*
      * Platform can use CONFIG_TFM_HAL_FINISH_BOOT option to add extra initialization
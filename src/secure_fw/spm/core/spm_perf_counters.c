@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config_spm.h"
+
+#if CONFIG_TFM_PERF_COUNTERS
+
+#include "critical_section.h"
+#include "spm.h"
+#include "spm_perf_counters.h"
+#include "stack_watermark.h"
+#include "tfm_arch.h"
+#include "tfm_cycle_counter.h"
+#include "tfm_hal_isolation.h"
+#include "utilities.h"
+
+struct tfm_perf_counters_t tfm_perf_counters;
+
+static uint32_t nr_partition_counters;
+static uint32_t nr_service_counters;
+
+/* Cycle count at the last partition switch */
+static uint32_t last_switch;
+
+/* Counters updated by the partitions, indexed by TFM_PERF_* */
+static const struct {
+    uint32_t *p_level;
+    uint32_t *p_high_water;     /* NULL for an event counter */
+} partition_counters[TFM_PERF_COUNTER_ID_COUNT] = {
+    [TFM_PERF_CRYPTO_OPER]        = {&tfm_perf_counters.crypto_oper_in_use,
+                                     &tfm_perf_counters.crypto_oper_high_water},
+    [TFM_PERF_ITS_FLASH_READS]    = {&tfm_perf_counters.its_flash_reads, NULL},
+    [TFM_PERF_ITS_FLASH_PROGRAMS] = {&tfm_perf_counters.its_flash_programs, NULL},
+    [TFM_PERF_ITS_FLASH_ERASES]   = {&tfm_perf_counters.its_flash_erases, NULL},
+    [TFM_PERF_MAILBOX_QUEUE]      = {&tfm_perf_counters.mailbox_queue_depth,
+                                     &tfm_perf_counters.mailbox_queue_high_water},
+};
+
+__WEAK uint32_t spm_perf_get_cycles(void)
+{
+    /* Returns 0 without a cycle counter, the platform has to provide one */
+    return tfm_cycle_counter_read();
+}
+
+void spm_perf_counters_init(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < TFM_PERF_COUNTERS_MAX_PARTITIONS; i++) {
+        tfm_perf_counters.partitions[i].partition_id = -1;
+    }
+
+    last_switch = spm_perf_get_cycles();
+}
+
+void spm_perf_counters_add_partition(struct partition_t *p_pt)
+{
+    struct tfm_perf_partition_counter_t *p_counter = NULL;
+
+    if (nr_partition_counters < TFM_PERF_COUNTERS_MAX_PARTITIONS) {
+        p_counter = &tfm_perf_counters.partitions[nr_partition_counters++];
+        p_counter->partition_id = p_pt->p_ldinf->pid;
+    }
+
+    p_pt->p_counter = p_counter;
+}
+
+void spm_perf_counters_add_service(struct service_t *p_service)
+{
+    struct tfm_perf_service_counter_t *p_counter = NULL;
+
+    if (nr_service_counters < TFM_PERF_COUNTERS_MAX_SERVICES) {
+        p_counter = &tfm_perf_counters.services[nr_service_counters++];
+        p_counter->sid = p_service->p_ldinf->sid;
+    }
+
+    p_service->p_counter = p_counter;
+}
+
+psa_status_t spm_perf_counter_update(uint32_t id, uint32_t op, uint32_t value)
+{
+    struct critical_section_t cs_assert = CRITICAL_SECTION_STATIC_INIT;
+    uint32_t *p_level;
+    uint32_t *p_high_water;
+
+    if (id >= TFM_PERF_COUNTER_ID_COUNT) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    p_level = partition_counters[id].p_level;
+    p_high_water = partition_counters[id].p_high_water;
+
+    /* Events can only be counted */
+    if ((op != TFM_PERF_OP_INC) && (p_high_water == NULL)) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    CRITICAL_SECTION_ENTER(cs_assert);
+
+    switch (op) {
+    case TFM_PERF_OP_INC:
+        (*p_level)++;
+        break;
+    case TFM_PERF_OP_DEC:
+        (*p_level)--;
+        break;
+    case TFM_PERF_OP_SET:
+        *p_level = value;
+        break;
+    default:
+        CRITICAL_SECTION_LEAVE(cs_assert);
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+
+    if ((p_high_water != NULL) && (*p_level > *p_high_water)) {
+        *p_high_water = *p_level;
+    }
+
+    CRITICAL_SECTION_LEAVE(cs_assert);
+
+    return PSA_SUCCESS;
+}
+
+void spm_perf_counters_read_handler(uint32_t args[])
+{
+    void *p_buf = (void *)args[0];
+    uint32_t size = args[1];
+    struct partition_t *curr_partition = GET_CURRENT_COMPONENT();
+    fih_int fih_rc = FIH_FAILURE;
+
+    if (size != sizeof(tfm_perf_counters)) {
+        args[0] = (uint32_t)PSA_ERROR_INVALID_ARGUMENT;
+        return;
+    }
+
+    FIH_CALL(tfm_hal_memory_check, fih_rc,
+             curr_partition->boundary, (uintptr_t)p_buf,
+             size, TFM_HAL_ACCESS_READWRITE);
+    if (fih_not_eq(fih_rc, fih_int_encode(PSA_SUCCESS))) {
+        args[0] = (uint32_t)PSA_ERROR_INVALID_ARGUMENT;
+        return;
+    }
+
+    /* The idle partition may not be built, bring the stack usage up to date */
+    stack_watermark_update_all();
+
+    /* The counters keep changing, the copy is not an atomic snapshot */
+    spm_memcpy(p_buf, &tfm_perf_counters, size);
+
+    args[0] = (uint32_t)PSA_SUCCESS;
+}
+
+void spm_perf_counters_switch(const struct partition_t *p_pt)
+{
+    uint32_t now = spm_perf_get_cycles();
+
+    /* A partition running for more than 2^32 cycles in one go loses time */
+    if (p_pt->p_counter != NULL) {
+        p_pt->p_counter->cycles += now - last_switch;
+    }
+
+    last_switch = now;
+}
+
+#endif /* CONFIG_TFM_PERF_COUNTERS */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __SPM_PERF_COUNTERS_H__
+#define __SPM_PERF_COUNTERS_H__
+
+#include <stdint.h>
+#include "config_spm.h"
+#include "spm.h"
+#include "tfm_perf_counters.h"
+
+#if CONFIG_TFM_PERF_COUNTERS
+extern struct tfm_perf_counters_t tfm_perf_counters;
+
+/**
+ * \brief   Mark all the service and partition counters as unused. Called
+ *          before loading the partitions.
+ */
+void spm_perf_counters_init(void);
+
+/**
+ * \brief   Give a partition its cycle counter, if one is left.
+ *
+ * \param[in] p_pt      The partition being loaded.
+ */
+void spm_perf_counters_add_partition(struct partition_t *p_pt);
+
+/**
+ * \brief   Give a service its call counter, if one is left.
+ *
+ * \param[in] p_service The service being loaded.
+ */
+void spm_perf_counters_add_service(struct service_t *p_service);
+
+/**
+ * \brief   Charge the cycles since the previous switch to the partition being
+ *          switched away from. Called by the scheduler.
+ *
+ * \param[in] p_pt      The partition that was running.
+ */
+void spm_perf_counters_switch(const struct partition_t *p_pt);
+
+/**
+ * \brief   Get the cycle count used for the partition counters. The default
+ *          implementation returns the DWT cycle counter, platforms can
+ *          override it.
+ */
+uint32_t spm_perf_get_cycles(void);
+
+/**
+ * \brief   Apply an update from a partition to one of its counters. Called
+ *          by the SVC handler of tfm_perf_counter_update().
+ *
+ * \param[in] id        The counter, one of TFM_PERF_*.
+ * \param[in] op        TFM_PERF_OP_INC, TFM_PERF_OP_DEC or TFM_PERF_OP_SET.
+ * \param[in] value     The new level for TFM_PERF_OP_SET.
+ *
+ * \retval PSA_SUCCESS                  The counter is updated.
+ * \retval PSA_ERROR_INVALID_ARGUMENT   Unknown counter or operation.
+ */
+psa_status_t spm_perf_counter_update(uint32_t id, uint32_t op, uint32_t value);
+
+/**
+ * \brief   Copy the counters to the buffer of the calling partition, after
+ *          bringing the stack watermarks up to date. Called by the SVC
+ *          handler of tfm_perf_counters_read().
+ *
+ * \param[in,out] args  The SVC arguments: the buffer and its size in, the
+ *                      status out.
+ */
+void spm_perf_counters_read_handler(uint32_t args[]);
+
+/* Allocate or release an SPM resource, keeping track of its highest usage */
+#define SPM_PERF_LEVEL_INC(level, high_water)                           \
+    do {                                                                \
+        tfm_perf_counters.level++;                                      \
+        if (tfm_perf_counters.level > tfm_perf_counters.high_water) {   \
+            tfm_perf_counters.high_water = tfm_perf_counters.level;     \
+        }                                                               \
+    } while (0)
+
+#define SPM_PERF_LEVEL_DEC(level)       \
+    do {                                \
+        tfm_perf_counters.level--;      \
+    } while (0)
+
+/* Count a psa_call() to a service */
+#define SPM_PERF_SERVICE_CALL(p_service)                \
+    do {                                                \
+        if ((p_service)->p_counter != NULL) {           \
+            (p_service)->p_counter->calls++;            \
+        }                                               \
+    } while (0)
+#else
+#define spm_perf_counters_init()
+#define spm_perf_counters_add_partition(p_pt)
+#define spm_perf_counters_add_service(p_service)
+#define spm_perf_counters_switch(p_pt)
+#define SPM_PERF_SERVICE_CALL(p_service)        do {} while (0)
+#define SPM_PERF_LEVEL_INC(level, high_water)   do {} while (0)
+#define SPM_PERF_LEVEL_DEC(level)               do {} while (0)
+#endif
+
+#endif /* __SPM_PERF_COUNTERS_H__ */
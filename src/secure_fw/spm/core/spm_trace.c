@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <stdint.h>
+#include "config_spm.h"
+
+#if CONFIG_TFM_SPM_TRACE_ENTRIES > 0
+
+#include "critical_section.h"
+#include "spm.h"
+#include "spm_trace.h"
+#include "tfm_arch.h"
+#include "tfm_cycle_counter.h"
+#include "utilities.h"
+
+/* Sequence numbers wrap consistently with the ring index */
+#if (CONFIG_TFM_SPM_TRACE_ENTRIES & (CONFIG_TFM_SPM_TRACE_ENTRIES - 1)) != 0
+#error "CONFIG_TFM_SPM_TRACE_ENTRIES must be a power of two"
+#endif
+
+#define TRACE_SLOT(seq)     ((seq) & (CONFIG_TFM_SPM_TRACE_ENTRIES - 1))
+
+static struct tfm_spm_trace_record_t trace_ring[CONFIG_TFM_SPM_TRACE_ENTRIES];
+
+/* Sequence number of the next record */
+static volatile uint32_t trace_next;
+
+__WEAK uint32_t spm_trace_get_timestamp(void)
+{
+    /* Returns 0 without a cycle counter, the platform has to provide one */
+    return tfm_cycle_counter_read();
+}
+
+/* Reserve the sequence number of a new record */
+static uint32_t trace_reserve(void)
+{
+    uint32_t seq;
+#if defined(__ARM_ARCH_6M__)
+    struct critical_section_t cs_trace = CRITICAL_SECTION_STATIC_INIT;
+
+    CRITICAL_SECTION_ENTER(cs_trace);
+    seq = trace_next++;
+    CRITICAL_SECTION_LEAVE(cs_trace);
+#else
+    do {
+        seq = __LDREXW(&trace_next);
+    } while (__STREXW(seq + 1, &trace_next) != 0U);
+#endif
+
+    return seq;
+}
+
+void spm_trace(uint16_t event, const struct partition_t *p_pt,
+               uint32_t arg0, uint32_t arg1)
+{
+    uint32_t seq = trace_reserve();
+    struct tfm_spm_trace_record_t *p_rec = &trace_ring[TRACE_SLOT(seq)];
+
+    /*
+     * A sequence number readers never expect in this slot marks the record
+     * as being written.
+     */
+    p_rec->seq = seq - 1;
+    __DMB();
+
+    p_rec->timestamp = spm_trace_get_timestamp();
+    p_rec->event = event;
+    p_rec->partition_id = (p_pt != NULL) ? (int16_t)p_pt->p_ldinf->pid : 0;
+    p_rec->arg0 = arg0;
+    p_rec->arg1 = arg1;
+
+    __DMB();
+    p_rec->seq = seq;
+}
+
+uint32_t spm_trace_read(uint32_t seq, void *p_records, uint32_t count)
+{
+    struct tfm_spm_trace_record_t record;
+    uint8_t *p_out = (uint8_t *)p_records;
+    uint32_t next = trace_next;
+    uint32_t copied = 0;
+
+    /* Older records have been overwritten */
+    if ((next - seq) > CONFIG_TFM_SPM_TRACE_ENTRIES) {
+        seq = next - CONFIG_TFM_SPM_TRACE_ENTRIES;
+    }
+
+    for (; (seq != next) && (copied < count); seq++) {
+        const struct tfm_spm_trace_record_t *p_rec = &trace_ring[TRACE_SLOT(seq)];
+
+        /*
+         * Stop at a record still being written, it can be read later. Until
+         * the ring wraps, such a record can also be all zeros.
+         */
+        if (((int32_t)(p_rec->seq - seq) < 0) || (p_rec->event == 0U)) {
+            break;
+        }
+
+        __DMB();
+        record = *p_rec;
+        __DMB();
+
+        /* Skip the record if a writer has replaced it meanwhile */
+        if ((p_rec->seq != seq) || (record.seq != seq)) {
+            continue;
+        }
+
+        spm_memcpy(p_out, &record, sizeof(record));
+        p_out += sizeof(record);
+        copied++;
+    }
+
+    return copied;
+}
+
+#endif /* CONFIG_TFM_SPM_TRACE_ENTRIES > 0 */
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __SPM_TRACE_H__
+#define __SPM_TRACE_H__
+
+#include <stdint.h>
+#include "config_spm.h"
+#include "spm.h"
+#include "tfm_spm_trace_defs.h"
+
+#if CONFIG_TFM_SPM_TRACE_ENTRIES > 0
+/**
+ * \brief   Record an event in the SPM trace. Can be called from any context.
+ *
+ * \param[in] event     The event, TFM_SPM_TRACE_*.
+ * \param[in] p_pt      The partition of the event, NULL if none.
+ * \param[in] arg0      First argument of the event.
+ * \param[in] arg1      Second argument of the event.
+ */
+void spm_trace(uint16_t event, const struct partition_t *p_pt,
+               uint32_t arg0, uint32_t arg1);
+
+/**
+ * \brief   Copy the trace records from a sequence number. Records older than
+ *          the ring, or overwritten while being copied, are skipped. The copy
+ *          stops at a record still being written.
+ *
+ * \param[in]  seq          The sequence number of the first record wanted.
+ * \param[out] p_records    Buffer receiving struct tfm_spm_trace_record_t
+ *                          records, without alignment requirement.
+ * \param[in]  count        The number of records the buffer can hold.
+ *
+ * \return  The number of records copied.
+ */
+uint32_t spm_trace_read(uint32_t seq, void *p_records, uint32_t count);
+
+/**
+ * \brief   Get the timestamp of trace records. The default implementation
+ *          returns the DWT cycle counter, platforms can override it.
+ */
+uint32_t spm_trace_get_timestamp(void);
+
+#define SPM_TRACE(event, p_pt, arg0, arg1) \
+    spm_trace((event), (p_pt), (uint32_t)(arg0), (uint32_t)(arg1))
+#else
+#define SPM_TRACE(event, p_pt, arg0, arg1) do {} while (0)
+#endif
+
+#endif /* __SPM_TRACE_H__ */
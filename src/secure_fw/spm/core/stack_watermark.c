@@ -1,16 +1,19 @@
 /*
- * Copyright (c) 2022, Cypress Semiconductor Corporation. All rights reserved.
+ * Copyright (c) 2022-2025, Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
  */
 
+#include <stdbool.h>
 #include <stdint.h>
+#include "critical_section.h"
 #include "ffm/backend.h"
 #include "stack_watermark.h"
 #include "lists.h"
 #include "load/spm_load_api.h"
 #include "spm.h"
+#include "spm_perf_counters.h"
 #include "tfm_spm_log.h"
 
 /* Always output, regardless of log level.
@@ -21,6 +24,13 @@
 
 #define STACK_WATERMARK_VAL 0xdeadbeef
 
+/* Words checked by each stack_watermark_update_step(), bounding its latency */
+#define STACK_WATERMARK_STEP_WORDS  32
+
+/* Position of the incremental scan */
+static struct partition_t *p_scan_pt;
+static uint32_t scan_words;
+
 void watermark_stack(struct partition_t *p_pt)
 {
     const struct partition_load_info_t *p_pldi = p_pt->p_ldinf;
@@ -28,30 +38,106 @@ void watermark_stack(struct partition_t *p_pt)
     for (int i = 0; i < p_pldi->stack_size / 4; i++) {
         *((uint32_t *)LOAD_ALLOCED_STACK_ADDR(p_pldi) + i) = STACK_WATERMARK_VAL;
     }
+
+    p_pt->stack_unused_words = p_pldi->stack_size / 4;
 }
 
 /* Returns the number of bytes of stack that have been used by the specified partition */
-static uint32_t used_stack(struct partition_t *p_pt)
+static uint32_t used_stack(const struct partition_t *p_pt)
 {
-    const struct partition_load_info_t *p_pldi = p_pt->p_ldinf;
-    uint32_t unused_words = 0;
+    return p_pt->p_ldinf->stack_size - (p_pt->stack_unused_words * 4);
+}
+
+/*
+ * Check up to 'count' words of the stack still unused at the last scan,
+ * starting 'from' words above the bottom. The stack grows down, so the first
+ * word found modified from the bottom is the new watermark.
+ * Returns true once the first modified word is found or the whole unused
+ * region is checked.
+ */
+static bool scan_stack(struct partition_t *p_pt, uint32_t from, uint32_t count)
+{
+    const uint32_t *p_stack =
+                (const uint32_t *)LOAD_ALLOCED_STACK_ADDR(p_pt->p_ldinf);
+    uint32_t end = p_pt->stack_unused_words;
+    uint32_t i;
+
+    if (from >= end) {
+        return true;
+    }
+
+    if (count > end - from) {
+        count = end - from;
+    }
 
-    for (const uint32_t *p = (uint32_t *)LOAD_ALLOCED_STACK_ADDR(p_pldi);
-         p < (uint32_t *)(LOAD_ALLOCED_STACK_ADDR(p_pldi) + p_pldi->stack_size);
-         p++) {
-        if (*p != STACK_WATERMARK_VAL) {
-            break;
+    for (i = from; i < from + count; i++) {
+        if (p_stack[i] != STACK_WATERMARK_VAL) {
+            p_pt->stack_unused_words = i;
+#if CONFIG_TFM_PERF_COUNTERS
+            if (p_pt->p_counter != NULL) {
+                p_pt->p_counter->stack_used = used_stack(p_pt);
+            }
+#endif
+            return true;
         }
-        unused_words++;
     }
 
-    return p_pldi->stack_size - (unused_words * 4);
+    return (from + count) == end;
+}
+
+void stack_watermark_update_step(void)
+{
+    struct critical_section_t cs_assert = CRITICAL_SECTION_STATIC_INIT;
+
+    CRITICAL_SECTION_ENTER(cs_assert);
+
+    if (p_scan_pt == NULL) {
+        p_scan_pt = PARTITION_LIST_ADDR->next;
+        scan_words = 0;
+    }
+
+    if (p_scan_pt != NULL) {
+        if (scan_stack(p_scan_pt, scan_words, STACK_WATERMARK_STEP_WORDS)) {
+            /* Done with this partition, the next step checks the next one */
+            p_scan_pt = p_scan_pt->next;
+            scan_words = 0;
+        } else {
+            scan_words += STACK_WATERMARK_STEP_WORDS;
+        }
+    }
+
+    CRITICAL_SECTION_LEAVE(cs_assert);
+}
+
+void stack_watermark_update_all(void)
+{
+    struct critical_section_t cs_assert = CRITICAL_SECTION_STATIC_INIT;
+    struct partition_t *p_pt;
+    uint32_t from;
+    bool done;
+
+    UNI_LIST_FOREACH(p_pt, PARTITION_LIST_ADDR, next) {
+        /* Same steps as the incremental scan, to keep the latency bounded */
+        from = 0;
+        do {
+            CRITICAL_SECTION_ENTER(cs_assert);
+            done = scan_stack(p_pt, from, STACK_WATERMARK_STEP_WORDS);
+            if (done && (p_pt == p_scan_pt)) {
+                /* The incremental scan of this partition is complete */
+                scan_words = 0;
+            }
+            CRITICAL_SECTION_LEAVE(cs_assert);
+            from += STACK_WATERMARK_STEP_WORDS;
+        } while (!done);
+    }
 }
 
 void dump_used_stacks(void)
 {
     struct partition_t *p_pt;
 
+    stack_watermark_update_all();
+
     SPMLOG("Used stack sizes report\r\n");
     UNI_LIST_FOREACH(p_pt, PARTITION_LIST_ADDR, next) {
         SPMLOG_VAL("  Partition id: ", p_pt->p_ldinf->pid);
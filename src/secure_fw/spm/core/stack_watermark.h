@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, Cypress Semiconductor Corporation. All rights reserved.
+ * Copyright (c) 2022-2025, Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -13,9 +13,29 @@
 #ifdef CONFIG_TFM_STACK_WATERMARKS
 void watermark_stack(struct partition_t *p_pt);
 void dump_used_stacks(void);
+
+/**
+ * \brief   Check a few more words of the partition stacks for a new
+ *          watermark. Only the words below the last known watermark of each
+ *          partition are checked, a bounded number per call, so it can be
+ *          called periodically, for example by the scheduler when it
+ *          switches to the idle partition.
+ *          The used sizes are reported in the performance counters.
+ */
+void stack_watermark_update_step(void);
+
+/**
+ * \brief   Check the partition stacks up to their current watermarks, in
+ *          the same bounded steps as stack_watermark_update_step(). Used
+ *          when the performance counters are read, so they are up to date
+ *          even without the idle partition. Only called by the SPM.
+ */
+void stack_watermark_update_all(void);
 #else
 #define watermark_stack(p_pt)
 #define dump_used_stacks()
+#define stack_watermark_update_step()
+#define stack_watermark_update_all()
 #endif
 
 #endif /* __STACK_WATERMARK_H__ */
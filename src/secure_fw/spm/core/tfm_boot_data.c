@@ -46,6 +46,92 @@
  */
 static uint32_t is_boot_data_valid = BOOT_DATA_INVALID;
 
+#ifdef BOOT_DATA_AVAILABLE
+/*!
+ * \def BOOT_DATA_MAJOR_TYPES
+ *
+ * \brief Number of distinct major types which can be encoded in a TLV type.
+ */
+#define BOOT_DATA_MAJOR_TYPES (MAJOR_MASK + 1u)
+
+/* The index stores offsets in the shared data area on 16 bits */
+#if BOOT_TFM_SHARED_DATA_SIZE > UINT16_MAX
+#error "BOOT_TFM_SHARED_DATA_SIZE must not exceed UINT16_MAX"
+#endif
+
+/*!
+ * \struct boot_data_index_entry
+ *
+ * \brief Location of the TLV entries of a given major type in the shared data
+ *        area, built once when the shared data is validated. Offsets are
+ *        relative to the beginning of the shared data area.
+ */
+struct boot_data_index_entry {
+    uint16_t first;      /* Offset of the first entry of this major type */
+    uint16_t end;        /* Offset right after the last entry */
+    uint16_t tot_len;    /* Total length of the entries, headers included */
+    uint8_t  contiguous; /* No entry of another major type in between */
+};
+
+/*!
+ * \var boot_data_index
+ *
+ * \brief Index of the shared data area by major type.
+ */
+static struct boot_data_index_entry boot_data_index[BOOT_DATA_MAJOR_TYPES];
+
+/*!
+ * \brief Walk the shared data area once to index the TLV entries by major type.
+ *
+ * \param[in]  boot_data  Shared data area, with a valid header.
+ *
+ * \return  Returns 0 in case of success, -1 if the TLV section is malformed.
+ */
+static int32_t tfm_core_index_boot_data(const struct tfm_boot_data *boot_data)
+{
+    struct shared_data_tlv_entry tlv_entry;
+    struct boot_data_index_entry *idx;
+    uint32_t offset = SHARED_DATA_HEADER_SIZE;
+    uint32_t tlv_end = boot_data->header.tlv_tot_len;
+    uint32_t next_tlv_offset;
+
+    if (tlv_end > BOOT_TFM_SHARED_DATA_SIZE) {
+        return -1;
+    }
+
+    (void)spm_memset(boot_data_index, 0, sizeof(boot_data_index));
+
+    while (offset < tlv_end) {
+        if ((offset + SHARED_DATA_ENTRY_HEADER_SIZE) > tlv_end) {
+            return -1;
+        }
+
+        /* Create local copy to avoid unaligned access */
+        (void)spm_memcpy(&tlv_entry, (const uint8_t *)boot_data + offset,
+                         SHARED_DATA_ENTRY_HEADER_SIZE);
+
+        next_tlv_offset = SHARED_DATA_ENTRY_HEADER_SIZE + tlv_entry.tlv_len;
+        if ((offset + next_tlv_offset) > tlv_end) {
+            return -1;
+        }
+
+        idx = &boot_data_index[GET_MAJOR(tlv_entry.tlv_type)];
+        if (idx->tot_len == 0) {
+            idx->first = (uint16_t)offset;
+            idx->contiguous = 1;
+        } else if (idx->end != offset) {
+            idx->contiguous = 0;
+        }
+        idx->end = (uint16_t)(offset + next_tlv_offset);
+        idx->tot_len += (uint16_t)next_tlv_offset;
+
+        offset += next_tlv_offset;
+    }
+
+    return 0;
+}
+#endif /* BOOT_DATA_AVAILABLE */
+
 /*!
  * \struct boot_data_access_policy
  *
@@ -137,7 +223,8 @@ void tfm_core_validate_boot_data(void)
 
     boot_data = (struct tfm_boot_data *)BOOT_TFM_SHARED_DATA_BASE;
 
-    if (boot_data->header.tlv_magic == SHARED_DATA_TLV_INFO_MAGIC) {
+    if ((boot_data->header.tlv_magic == SHARED_DATA_TLV_INFO_MAGIC) &&
+        (tfm_core_index_boot_data(boot_data) == 0)) {
         is_boot_data_valid = BOOT_DATA_VALID;
     }
 #else
@@ -154,6 +241,7 @@ void tfm_core_get_boot_data_handler(uint32_t args[])
 #ifdef BOOT_DATA_AVAILABLE
     uint8_t *ptr;
     struct shared_data_tlv_entry tlv_entry;
+    const struct boot_data_index_entry *idx;
     uintptr_t tlv_end, offset;
     size_t next_tlv_offset;
 #endif /* BOOT_DATA_AVAILABLE */
@@ -180,10 +268,8 @@ void tfm_core_get_boot_data_handler(uint32_t args[])
     }
 
 #ifdef BOOT_DATA_AVAILABLE
-    /* Get the boundaries of TLV section */
-    boot_data = (struct tfm_boot_data *)BOOT_TFM_SHARED_DATA_BASE;
-    tlv_end = BOOT_TFM_SHARED_DATA_BASE + boot_data->header.tlv_tot_len;
-    offset  = BOOT_TFM_SHARED_DATA_BASE + SHARED_DATA_HEADER_SIZE;
+    /* The major type is checked against the access policy above */
+    idx = &boot_data_index[tlv_major & MAJOR_MASK];
 #endif /* BOOT_DATA_AVAILABLE */
 
     /* Add header to output buffer as well */
@@ -199,9 +285,29 @@ void tfm_core_get_boot_data_handler(uint32_t args[])
 
 #ifdef BOOT_DATA_AVAILABLE
     ptr = boot_data->data;
-    /* Iterates over the TLV section and copy TLVs with requested major
-     * type to the provided buffer.
+
+    /* Check buffer overflow */
+    if ((SHARED_DATA_HEADER_SIZE + (size_t)idx->tot_len) > buf_size) {
+        args[0] = (uint32_t)PSA_ERROR_INVALID_ARGUMENT;
+        return;
+    }
+
+    if (idx->contiguous) {
+        /* All the TLVs with requested major type in a single copy */
+        TFM_COVERITY_DEVIATE_LINE(MISRA_C_2023_Rule_11_6, "Intentional pointer cast")
+        (void)spm_memcpy(ptr,
+                         (const void *)(BOOT_TFM_SHARED_DATA_BASE + idx->first),
+                         idx->tot_len);
+        boot_data->header.tlv_tot_len += idx->tot_len;
+        args[0] = (uint32_t)PSA_SUCCESS;
+        return;
+    }
+
+    /* Iterates over the indexed range of the TLV section and copy TLVs with
+     * requested major type to the provided buffer.
      */
+    tlv_end = BOOT_TFM_SHARED_DATA_BASE + idx->end;
+    offset  = BOOT_TFM_SHARED_DATA_BASE + idx->first;
     for (; offset < tlv_end; offset += next_tlv_offset) {
         /* Create local copy to avoid unaligned access */
         TFM_COVERITY_DEVIATE_LINE(MISRA_C_2023_Rule_11_6, "Intentional pointer cast")
@@ -211,12 +317,6 @@ void tfm_core_get_boot_data_handler(uint32_t args[])
         next_tlv_offset = SHARED_DATA_ENTRY_HEADER_SIZE + tlv_entry.tlv_len;
 
         if (GET_MAJOR(tlv_entry.tlv_type) == tlv_major) {
-            /* Check buffer overflow */
-            if (((ptr - buf_start) + next_tlv_offset) > buf_size) {
-                args[0] = (uint32_t)PSA_ERROR_INVALID_ARGUMENT;
-                return;
-            }
-
             TFM_COVERITY_DEVIATE_LINE(MISRA_C_2023_Rule_11_6, "Intentional pointer cast")
             (void)spm_memcpy(ptr, (const void *)offset, next_tlv_offset);
             ptr += next_tlv_offset;
@@ -15,6 +15,7 @@
 #include "internal_status_code.h"
 #include "memory_symbols.h"
 #include "spm.h"
+#include "spm_perf_counters.h"
 #include "static_checks.h"
 #include "svc_num.h"
 #include "tfm_arch.h"
@@ -308,6 +309,15 @@ static uint32_t handle_spm_svc_requests(uint32_t svc_number, uint32_t exc_return
         }
         break;
 #endif
+#if CONFIG_TFM_PERF_COUNTERS
+    case TFM_SVC_PERF_COUNTER_UPDATE:
+        svc_args[0] = (uint32_t)spm_perf_counter_update(svc_args[0], svc_args[1],
+                                                        svc_args[2]);
+        break;
+    case TFM_SVC_PERF_COUNTERS_READ:
+        spm_perf_counters_read_handler(svc_args);
+        break;
+#endif
 #if TFM_ISOLATION_LEVEL > 1
     case TFM_SVC_THREAD_MODE_SPM_RETURN:
         exc_return = thread_mode_spm_return(svc_args[0], msp);
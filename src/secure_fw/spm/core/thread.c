@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2018-2023, Arm Limited. All rights reserved.
- * Copyright (c) 2023 Cypress Semiconductor Corporation (an Infineon
+ * Copyright (c) 2023-2025 Cypress Semiconductor Corporation (an Infineon
  * company) or an affiliate of Cypress Semiconductor Corporation. All rights
  * reserved.
  *
@@ -96,6 +96,36 @@ void thrd_start(struct thread_t *p_thrd, thrd_fn_t fn, thrd_fn_t exit_fn, void *
     thrd_set_state(p_thrd, THRD_STATE_RUNNABLE);
 }
 
+void thrd_set_priority(struct thread_t *p_thrd, uint8_t priority)
+{
+    struct critical_section_t cs_prior = CRITICAL_SECTION_STATIC_INIT;
+    struct thread_t **pp_iter;
+
+    SPM_ASSERT(p_thrd != NULL);
+
+    if (p_thrd->priority == priority) {
+        return;
+    }
+
+    CRITICAL_SECTION_ENTER(cs_prior);
+
+    /* Move the thread to its new place in the sorted list */
+    for (pp_iter = &LIST_HEAD; *pp_iter != NULL; pp_iter = &(*pp_iter)->next) {
+        if (*pp_iter == p_thrd) {
+            *pp_iter = p_thrd->next;
+            break;
+        }
+    }
+
+    p_thrd->priority = priority;
+    insert_by_prior(&LIST_HEAD, p_thrd);
+
+    /* The first runnable thread may have changed */
+    RNBL_HEAD = LIST_HEAD;
+
+    CRITICAL_SECTION_LEAVE(cs_prior);
+}
+
 void thrd_set_state(struct thread_t *p_thrd, uint32_t new_state)
 {
     SPM_ASSERT(p_thrd != NULL);
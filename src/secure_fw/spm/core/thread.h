@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2018-2023, Arm Limited. All rights reserved.
- * Copyright (c) 2023 Cypress Semiconductor Corporation (an Infineon
+ * Copyright (c) 2023-2025 Cypress Semiconductor Corporation (an Infineon
  * company) or an affiliate of Cypress Semiconductor Corporation. All rights
  * reserved.
  *
@@ -88,6 +88,20 @@ extern struct thread_t *p_curr_thrd;
 #define THRD_SET_PRIORITY(p_thrd, priority) \
                                         p_thrd->priority = (uint8_t)(priority)
 
+/*
+ * Change the priority of a started thread and move it in the schedulable
+ * list accordingly.
+ *
+ * Parameters :
+ *  p_thrd         -     Pointer of thread_t struct
+ *  priority       -     Priority value (0~255)
+ *
+ * Note :
+ *  - The caller must trigger the scheduler if the change makes another
+ *    thread the one to run.
+ */
+void thrd_set_priority(struct thread_t *p_thrd, uint8_t priority);
+
 /*
  * Update current thread's bound context pointer.
  *
@@ -1,5 +1,7 @@
 /*
  * Copyright (c) 2018-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+ * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -62,7 +64,7 @@ extern "C" {
  * |---------------------------------------|
  * | MAJOR_MBS   | slot ID  (6) | claim(6) |
  * |---------------------------------------|
- * | MAJOR_CORE  |          TBD            |
+ * | MAJOR_CORE  | image ID (6) | claim(6) |
  * |---------------------------------------|
  */
 
@@ -150,6 +152,17 @@ extern "C" {
                     (MASK_LEFT_SHIFT(sw_module, MODULE_MASK, MODULE_POS) | \
                      MASK_LEFT_SHIFT(claim, CLAIM_MASK, CLAIM_POS))
 
+/* Core specific macros */
+#define CORE_IMAGE_VALIDATION_TIME 0x00 /* BL2 cycles spent on an image */
+
+#define GET_CORE_IMAGE(tlv_type) \
+                    MASK_RIGHT_SHIFT(tlv_type, MINOR_MASK, MODULE_POS)
+#define GET_CORE_CLAIM(tlv_type) \
+                    MASK_RIGHT_SHIFT(tlv_type, CLAIM_MASK, CLAIM_POS)
+#define SET_CORE_MINOR(image_id, claim) \
+                    (MASK_LEFT_SHIFT(image_id, MODULE_MASK, MODULE_POS) | \
+                     MASK_LEFT_SHIFT(claim, CLAIM_MASK, CLAIM_POS))
+
 /* Magic value which marks the beginning of shared data area in memory */
 #define SHARED_DATA_TLV_INFO_MAGIC    0x2016
 
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2021-2023, Arm Limited. All rights reserved.
- * Copyright (c) 2023-2024 Cypress Semiconductor Corporation (an Infineon company)
+ * Copyright (c) 2023-2025 Cypress Semiconductor Corporation (an Infineon company)
  * or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -75,6 +75,8 @@
 #define TFM_SVC_OUTPUT_UNPRIV_STRING    TFM_SVC_NUM_SPM_THREAD(2)
 #define TFM_SVC_GET_BOOT_DATA           TFM_SVC_NUM_SPM_THREAD(3)
 #define TFM_SVC_THREAD_MODE_SPM_RETURN  TFM_SVC_NUM_SPM_THREAD(4)
+#define TFM_SVC_PERF_COUNTER_UPDATE     TFM_SVC_NUM_SPM_THREAD(5)
+#define TFM_SVC_PERF_COUNTERS_READ      TFM_SVC_NUM_SPM_THREAD(6)
 
 /* TF-M SPM and for Handler mode */
 #define TFM_SVC_PREPARE_DEPRIV_FLIH     TFM_SVC_NUM_SPM_HANDLER(0)
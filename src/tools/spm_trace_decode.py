@@ -0,0 +1,139 @@
+#-------------------------------------------------------------------------------
+# Copyright (c) 2025 Cypress Semiconductor Corporation (an Infineon company)
+# or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+#-------------------------------------------------------------------------------
+
+"""
+Decode SPM trace records and report per-service latencies.
+
+The input is the raw array of struct tfm_spm_trace_record_t read with
+ifx_platform_spm_trace_read(), either as a binary file or as a hex dump.
+The latency of a call is the time between its TFM_SPM_TRACE_PSA_CALL record
+and the first TFM_SPM_TRACE_PSA_REPLY or TFM_SPM_TRACE_PSA_CALL_RETURN record
+of the same connection.
+"""
+
+import argparse
+import struct
+import sys
+
+# Keep in sync with interface/include/tfm_spm_trace_defs.h
+RECORD = struct.Struct('<IIHhII')
+
+EVENTS = {
+    1: 'PSA_CALL',
+    2: 'PSA_CALL_RETURN',
+    3: 'PSA_GET',
+    4: 'PSA_REPLY',
+    5: 'CONTEXT_SWITCH',
+    6: 'IRQ_ASSERT',
+    7: 'BOUNDARY_SWITCH',
+}
+
+EVENT_PSA_CALL = 1
+EVENT_PSA_CALL_RETURN = 2
+EVENT_PSA_REPLY = 4
+
+
+def read_records(path, is_hex):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if is_hex:
+        data = bytes.fromhex(data.decode('ascii'))
+
+    if len(data) % RECORD.size:
+        print('warning: ignoring {} trailing bytes'.format(len(data) % RECORD.size),
+              file=sys.stderr)
+
+    count = len(data) // RECORD.size
+    return [RECORD.unpack_from(data, i * RECORD.size) for i in range(count)]
+
+
+def bucket_label(low, high, cycles_per_us):
+    if cycles_per_us:
+        return '{:>10.1f} - {:<10.1f} us'.format(low / cycles_per_us,
+                                                 high / cycles_per_us)
+    return '{:>10} - {:<10} cycles'.format(low, high)
+
+
+def print_histogram(sid, latencies, cycles_per_us):
+    total = sum(latencies)
+    print('SID 0x{:08x}: {} calls, min {}, avg {}, max {} cycles'.format(
+          sid, len(latencies), min(latencies), total // len(latencies),
+          max(latencies)))
+
+    # Power of two buckets
+    buckets = {}
+    for latency in latencies:
+        order = latency.bit_length()
+        buckets[order] = buckets.get(order, 0) + 1
+
+    width = max(buckets.values())
+    for order in sorted(buckets):
+        low = (1 << (order - 1)) if order else 0
+        high = (1 << order) - 1 if order else 0
+        bar = '#' * max(1, buckets[order] * 40 // width)
+        print('  {} {:>8} {}'.format(bucket_label(low, high, cycles_per_us),
+                                     buckets[order], bar))
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split('\n')[0])
+    parser.add_argument('trace', help='file holding the trace records')
+    parser.add_argument('--hex', action='store_true',
+                        help='the file is a hex dump instead of binary')
+    parser.add_argument('--cycles-per-us', type=float, default=0,
+                        help='timestamp frequency in MHz, to report microseconds')
+    parser.add_argument('--dump', action='store_true',
+                        help='print every record')
+    args = parser.parse_args()
+
+    records = read_records(args.trace, args.hex)
+    pending = {}
+    latencies = {}
+    expected_seq = None
+    lost = 0
+
+    for seq, timestamp, event, partition_id, arg0, arg1 in records:
+        if expected_seq is not None and seq != expected_seq:
+            lost += (seq - expected_seq) & 0xFFFFFFFF
+            # Calls in flight across the gap cannot be matched
+            pending.clear()
+        expected_seq = (seq + 1) & 0xFFFFFFFF
+
+        if args.dump:
+            print('{:10} {:10} {:>16} pid {:5} 0x{:08x} 0x{:08x}'.format(
+                  seq, timestamp, EVENTS.get(event, str(event)), partition_id,
+                  arg0, arg1))
+
+        if event == EVENT_PSA_CALL:
+            # arg0 is the SID, arg1 the connection
+            pending[arg1] = (arg0, timestamp)
+        elif event in (EVENT_PSA_REPLY, EVENT_PSA_CALL_RETURN):
+            call = pending.pop(arg1, None)
+            if call is not None:
+                sid, start = call
+                # The timestamp is a wrapping 32-bit counter
+                latency = (timestamp - start) & 0xFFFFFFFF
+                latencies.setdefault(sid, []).append(latency)
+
+    if args.dump:
+        print()
+
+    if lost:
+        print('{} records lost, calls across the gaps are ignored\n'.format(lost))
+
+    for sid in sorted(latencies):
+        print_histogram(sid, latencies[sid], args.cycles_per_us)
+
+    if not latencies:
+        print('No complete calls in the trace')
+
+
+if __name__ == '__main__':
+    main()
@@ -1,6 +1,6 @@
 #-------------------------------------------------------------------------------
 # Copyright (c) 2018-2024, Arm Limited. All rights reserved.
-# Copyright (c) 2022 Cypress Semiconductor Corporation (an Infineon company)
+# Copyright (c) 2022-2025 Cypress Semiconductor Corporation (an Infineon company)
 # or an affiliate of Cypress Semiconductor Corporation. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
@@ -423,7 +423,9 @@ def process_partition_manifests(manifest_lists, configs):
         # number (0) when there are no irqs.
         irq_idx = -1
         for irq_idx, irq in enumerate(manifest.get('irqs', [])):
-            # Assign signal value, from the most significant bit
+            # Assign signal value, from the most significant bit. The SPM
+            # finds the load info of an IRQ from the leading zeros of its
+            # signal, keep the IRQs in this order in the load info.
             irq['signal_value'] = (1 << (31 - irq_idx))
             if irq.get('handling', None) == 'FLIH':
                 partition_statistics['flih_num'] += 1